@@ -60,6 +60,7 @@
 #include <trng/lagfib4xor.hpp>
 #include <trng/lagfib4plus.hpp>
 #include <trng/xoshiro256plus.hpp>
+#include <trng/philox4x32_10.hpp>
 
 #if defined TRNG_HAVE_BOOST
 #include <boost/random/linear_congruential.hpp>
@@ -305,6 +306,10 @@ int main() {
       trng::xoshiro256plus r;
       time_main(r, "trng::xoshiro256plus");
     }
+    {
+      trng::philox4x32_10 r;
+      time_main(r, "trng::philox4x32_10");
+    }
     {
       std::minstd_rand0 r;
       time_main(r, "std::minstd_rand0");
@@ -0,0 +1,135 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <vector>
+#include <trng/int_math.hpp>
+#include <trng/mrg2.hpp>
+
+// throughput of the table based modular exponentiation b^n mod m that forms the output
+// transformation of the YARN generators depending on the table layout, each table covers
+// a chunk of bits of the exponent n
+
+template<typename T>
+std::string to_string(const T &x) {
+  std::ostringstream temp;
+  temp << x;
+  return temp.str();
+}
+
+class timer {
+private:
+  std::chrono::time_point<std::chrono::high_resolution_clock> _t;
+
+public:
+  void reset() { _t = std::chrono::high_resolution_clock::now(); }
+  double time() const {
+    const auto now = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - _t).count() * 1e-6;
+  }
+  timer() : _t(std::chrono::high_resolution_clock::now()) {}
+};
+
+void print(const std::string &x) {
+  std::string res(x);
+  while (res.length() < 14)
+    res += ' ';
+  std::cout << res;
+}
+
+// modulus and generator of yarn2, yarn3, yarn4 and yarn5
+const int32_t modulus{2147483647}, gen{123567893};
+
+// random exponents
+const std::vector<int32_t> &exponents() {
+  static const std::vector<int32_t> n([]() {
+    std::vector<int32_t> n(1l << 22);
+    trng::mrg2 R;
+    for (auto &x : n)
+      x = R();
+    return n;
+  }());
+  return n;
+}
+
+template<int bits>
+void time_power() {
+  using power = trng::int_math::power<modulus, gen, bits>;
+  const power g;
+  const std::vector<int32_t> &n{exponents()};
+  std::vector<int32_t> y(n.size());
+  // a large buffer that competes with the tables for cache
+  std::vector<uint32_t> other(1l << 22);
+  int32_t s{g(1)};
+  print(to_string(bits));
+  print(to_string(power::table_size / 1024) + " KB");
+  timer T;
+  for (std::size_t i{0}; i < n.size(); ++i)
+    s ^= g(n[i]);
+  print(to_string(1e-6 * n.size() / T.time()));
+  T.reset();
+  for (std::size_t i{0}; i < n.size(); i += 16)
+    g(n.data() + i, y.data() + i, 16);
+  print(to_string(1e-6 * n.size() / T.time()));
+  T.reset();
+  for (std::size_t i{0}; i < n.size(); ++i) {
+    s ^= g(n[i]);
+    uint32_t &o{other[(static_cast<uint32_t>(s) * 2654435761u) % other.size()]};
+    o += static_cast<uint32_t>(s);
+  }
+  print(to_string(1e-6 * n.size() / T.time()));
+  std::cout << (s == 0 and y[0] == 0 ? " " : "") << '\n';
+}
+
+int main() {
+  std::cout << "million evaluations of b^n mod m per second\n\n";
+  print("bits");
+  print("tables");
+  print("scalar");
+  print("batch");
+  print("under load");
+  std::cout << '\n';
+  time_power<8>();
+  time_power<10>();
+  time_power<11>();
+  time_power<12>();
+  time_power<13>();
+  time_power<14>();
+  time_power<15>();
+  time_power<16>();
+  return EXIT_SUCCESS;
+}
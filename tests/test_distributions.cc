@@ -45,6 +45,10 @@
 #include <trng/uniform01_dist.hpp>
 #include <trng/special_functions.hpp>
 #include <trng/lcg64_shift.hpp>
+#include <trng/mrg3.hpp>
+#include <trng/yarn3.hpp>
+#include <trng/precision.hpp>
+#include <trng/generate_canonical.hpp>
 #include <trng/exponential_dist.hpp>
 #include <trng/twosided_exponential_dist.hpp>
 #include <trng/normal_dist.hpp>
@@ -207,6 +211,39 @@ bool continuous_dist_test_streamable(dist &d) {
 }
 
 
+// bulk generation must yield the same numbers as successive calls of operator()
+template<typename R, typename dist>
+bool dist_test_generate(dist &d) {
+  using result_type = typename dist::result_type;
+  R r1, r2;
+  dist d1{d}, d2{d};
+  std::vector<result_type> x(1000);
+  d1.generate(r1, x.begin(), x.end());
+  bool equal{true};
+  for (const auto &x_i : x)
+    equal = equal and x_i == d2(r2);
+  return equal and r1 == r2;
+}
+
+
+// as above but for distributions whose batch generation may differ from operator() by
+// rounding errors
+template<typename R, typename dist>
+bool dist_test_generate(dist &d, typename dist::result_type tolerance) {
+  using result_type = typename dist::result_type;
+  R r1, r2;
+  dist d1{d}, d2{d};
+  std::vector<result_type> x(1000);
+  d1.generate(r1, x.begin(), x.end());
+  bool close{true};
+  for (const auto &x_i : x) {
+    const result_type y{d2(r2)};
+    close = close and std::abs(x_i - y) <= tolerance * (1 + std::abs(y));
+  }
+  return close and r1 == r2;
+}
+
+
 template<typename dist>
 boost::test_tools::predicate_result discrete_dist_test(dist &d) {
   int i{d.min()};
@@ -276,6 +313,19 @@ bool discrete_dist_test_chi2_test(dist &d) {
 }
 
 
+// distribution that draws its random numbers by the per-call parameter path
+template<typename dist>
+class per_call_param_dist : public dist {
+public:
+  using dist::dist;
+  using dist::operator();
+  template<typename R>
+  typename dist::result_type operator()(R &r) {
+    return dist::operator()(r, this->param());
+  }
+};
+
+
 template<typename dist>
 bool discrete_dist_test_streamable(dist &d) {
   typename dist::param_type p_new;
@@ -308,6 +358,29 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_uniform01_dist, T, floats) {
   BOOST_TEST(continuous_dist_test_icdf(d));
   BOOST_TEST(continuous_dist_test_chi2_test(d));
   BOOST_TEST(continuous_dist_test_streamable(d));
+  BOOST_TEST(dist_test_generate<trng::lcg64_shift>(d));
+  BOOST_TEST(dist_test_generate<trng::mrg3>(d));
+}
+
+BOOST_AUTO_TEST_CASE(test_precision_policy) {
+  trng::yarn3 r1, r2, r3;
+  // a double with full precision takes two calls of a 31-bit engine, one call otherwise
+  const double x1{trng::utility::uniformco<double>(r1, trng::full_precision())};
+  const double x2{trng::generate_canonical<double>(r2, trng::full_precision())};
+  r3();
+  r3();
+  BOOST_TEST((r1 == r3 and r2 == r3 and 0 <= x1 and x1 < 1 and 0 < x2 and x2 < 1));
+  const double x3{trng::utility::uniformco<double>(r1, trng::engine_precision())};
+  BOOST_TEST((x3 == trng::utility::uniformco<double>(r3)));
+  // distributions fed by a precision_ref follow its policy
+  trng::uniform01_dist<double> u;
+  auto r4 = trng::with_precision<trng::full_precision>(r1);
+  const double x4{u(r4)};
+  BOOST_TEST((x4 == trng::utility::uniformco<double>(r3, trng::full_precision())));
+  std::vector<double> v1(17), v2(17);
+  u.generate(r4, v1.begin(), v1.end());
+  trng::utility::uniformco<double>(r3, v2.begin(), v2.end(), trng::full_precision());
+  BOOST_TEST((v1 == v2 and r1 == r3));
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_exponential_dist, T, floats) {
@@ -331,6 +404,15 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_normal_dist, T, floats) {
   BOOST_TEST(continuous_dist_test_integrate_pdf(d));
   BOOST_TEST(continuous_dist_test_icdf(d));
   BOOST_TEST(continuous_dist_test_chi2_test(d));
+  BOOST_TEST(continuous_dist_test_streamable(d));
+  BOOST_TEST(dist_test_generate<trng::lcg64_shift>(d, 64 * std::numeric_limits<T>::epsilon()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_normal_dist_ziggurat, T, floats) {
+  trng::normal_dist<T, trng::ziggurat_tag> d(T(5), T(2));
+  BOOST_TEST(continuous_dist_test_chi2_test(d));
+  BOOST_TEST(continuous_dist_test_streamable(d));
+  BOOST_TEST(dist_test_generate<trng::lcg64_shift>(d));
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_truncated_normal_dist, T, floats) {
@@ -421,6 +503,13 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_gamma_dist, T, floats) {
   BOOST_TEST(continuous_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_gamma_dist_marsaglia_tsang, T, floats) {
+  trng::gamma_dist<T, trng::marsaglia_tsang_tag> d1(T(5), T(2)), d2(T(0.5), T(2));
+  BOOST_TEST(continuous_dist_test_chi2_test(d1));
+  BOOST_TEST(continuous_dist_test_chi2_test(d2));
+  BOOST_TEST(continuous_dist_test_streamable(d1));
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_beta_dist, T, floats) {
   trng::beta_dist<T> d(T(3), T(2));
   BOOST_TEST(continuous_dist_test_integrate_pdf(d));
@@ -429,6 +518,21 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_beta_dist, T, floats) {
   BOOST_TEST(continuous_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_beta_dist_cheng, T, floats) {
+  trng::beta_dist<T, trng::cheng_tag> d1(T(3), T(2)), d2(T(0.5), T(3)), d3(T(50), T(0.05));
+  BOOST_TEST(continuous_dist_test_chi2_test(d1));
+  BOOST_TEST(continuous_dist_test_chi2_test(d2));
+  BOOST_TEST(continuous_dist_test_streamable(d1));
+  // large maximal shape and small minimal shape, a0 * exp(v) overflows regularly
+  trng::yarn3 R;
+  bool in_range{true};
+  for (int i{0}; i < 1000000; ++i) {
+    const T x{d3(R)};
+    in_range = in_range and std::isfinite(x) and 0 <= x and x <= 1;
+  }
+  BOOST_TEST(in_range);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_chi_square_dist, T, floats) {
   trng::chi_square_dist<T> d(38);
   BOOST_TEST(continuous_dist_test_integrate_pdf(d));
@@ -437,6 +541,12 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_chi_square_dist, T, floats) {
   BOOST_TEST(continuous_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_chi_square_dist_marsaglia_tsang, T, floats) {
+  trng::chi_square_dist<T, trng::marsaglia_tsang_tag> d(38);
+  BOOST_TEST(continuous_dist_test_chi2_test(d));
+  BOOST_TEST(continuous_dist_test_streamable(d));
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_student_t_dist, T, floats) {
   trng::student_t_dist<T> d(10);
   BOOST_TEST(continuous_dist_test_integrate_pdf(d));
@@ -488,6 +598,20 @@ BOOST_AUTO_TEST_CASE(test_binomial_dist) {
   BOOST_TEST(discrete_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE(test_binomial_dist_per_call_param) {
+  per_call_param_dist<trng::binomial_dist> d1(0.4, 20), d2(0.7, 200);
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+}
+
+BOOST_AUTO_TEST_CASE(test_binomial_dist_large_n) {
+  trng::binomial_dist d1(0.3, 5000), d2(0.99998, 100000);
+  BOOST_TEST(discrete_dist_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+  BOOST_TEST(discrete_dist_test_streamable(d1));
+}
+
 BOOST_AUTO_TEST_CASE(test_negative_binomial_dist) {
   trng::negative_binomial_dist d(0.4, 20);
   BOOST_TEST(discrete_dist_test(d));
@@ -495,6 +619,12 @@ BOOST_AUTO_TEST_CASE(test_negative_binomial_dist) {
   BOOST_TEST(discrete_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE(test_negative_binomial_dist_per_call_param) {
+  per_call_param_dist<trng::negative_binomial_dist> d1(0.4, 20), d2(0.5, 0.75);
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+}
+
 BOOST_AUTO_TEST_CASE(test_hypergeometric_dist) {
   trng::hypergeometric_dist d(10, 5, 5);
   BOOST_TEST(discrete_dist_test(d));
@@ -502,6 +632,31 @@ BOOST_AUTO_TEST_CASE(test_hypergeometric_dist) {
   BOOST_TEST(discrete_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE(test_hypergeometric_dist_large_support) {
+  trng::hypergeometric_dist d(20000, 6000, 4000);
+  BOOST_TEST(discrete_dist_test(d));
+  BOOST_TEST(discrete_dist_test_chi2_test(d));
+  BOOST_TEST(discrete_dist_test_streamable(d));
+}
+
+BOOST_AUTO_TEST_CASE(test_hypergeometric_dist_per_call_param) {
+  per_call_param_dist<trng::hypergeometric_dist> d1(100, 70, 20), d2(5000, 1000, 2000);
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+  // batch generation yields the same numbers as successive calls
+  using param_type = trng::hypergeometric_dist::param_type;
+  std::vector<param_type> P;
+  for (int i{1}; i <= 100; ++i)
+    P.push_back(param_type(100 * i, 30 * i, 20 + i));
+  trng::lcg64_shift r1, r2;
+  std::vector<int> x(P.size());
+  d1.generate(r1, P.begin(), P.end(), x.begin());
+  bool equal{true};
+  for (std::size_t i{0}; i < P.size(); ++i)
+    equal = equal and x[i] == d1(r2, P[i]);
+  BOOST_TEST((equal and r1 == r2));
+}
+
 BOOST_AUTO_TEST_CASE(test_geometric_dist) {
   trng::geometric_dist d(0.3);
   BOOST_TEST(discrete_dist_test(d));
@@ -516,6 +671,18 @@ BOOST_AUTO_TEST_CASE(test_poisson_dist) {
   BOOST_TEST(discrete_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE(test_poisson_dist_per_call_param) {
+  per_call_param_dist<trng::poisson_dist> d1(2.125), d2(31.5);
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+}
+
+BOOST_AUTO_TEST_CASE(test_poisson_dist_large_mean) {
+  trng::poisson_dist d(125.5);
+  BOOST_TEST(discrete_dist_test_chi2_test(d));
+  BOOST_TEST(discrete_dist_test_streamable(d));
+}
+
 BOOST_AUTO_TEST_CASE(test_zero_truncated_poisson_dist) {
   trng::zero_truncated_poisson_dist d(2.125);
   BOOST_TEST(discrete_dist_test(d));
@@ -523,6 +690,12 @@ BOOST_AUTO_TEST_CASE(test_zero_truncated_poisson_dist) {
   BOOST_TEST(discrete_dist_test_streamable(d));
 }
 
+BOOST_AUTO_TEST_CASE(test_zero_truncated_poisson_dist_per_call_param) {
+  per_call_param_dist<trng::zero_truncated_poisson_dist> d1(2.125), d2(31.5);
+  BOOST_TEST(discrete_dist_test_chi2_test(d1));
+  BOOST_TEST(discrete_dist_test_chi2_test(d2));
+}
+
 BOOST_AUTO_TEST_CASE(test_discrete_dist) {
   std::vector<int> p{1, 2, 3, 4, 5, 4, 3, 2, 1};
   trng::discrete_dist d(p.begin(), p.end());
@@ -32,6 +32,8 @@
 
 #include <vector>
 #include <string>
+#include <limits>
+#include <cmath>
 #include <sstream>
 #include <tuple>
 #include <ciso646>
@@ -44,6 +46,7 @@
 
 #include <trng/lcg64.hpp>
 #include <trng/lcg64_shift.hpp>
+#include <trng/lcg64_shift_simd.hpp>
 #include <trng/lcg64_count_shift.hpp>
 #include <trng/mrg2.hpp>
 #include <trng/mrg3.hpp>
@@ -64,6 +67,14 @@
 #include <trng/mt19937.hpp>
 #include <trng/mt19937_64.hpp>
 #include <trng/xoshiro256plus.hpp>
+#include <trng/philox4x32_10.hpp>
+#include <trng/split_streams.hpp>
+#include <trng/lcg64_stream_pool.hpp>
+#include <trng/stream_array.hpp>
+#include <trng/bit_harvester.hpp>
+#include <trng/uniform01_dist.hpp>
+#include <trng/bernoulli_dist.hpp>
+#include <trng/uniform_int_dist.hpp>
 
 #include "type_names.hpp"
 
@@ -76,14 +87,25 @@ using engines =
                      trng::lagfib2xor_521_64, trng::lagfib4xor_521_32,    //
                      trng::lagfib2plus_521_32, trng::lagfib4plus_521_64,  //
                      trng::mt19937, trng::mt19937_64,                     //
-                     trng::xoshiro256plus>;
+                     trng::xoshiro256plus, trng::lcg64_shift_simd<4>,     //
+                     trng::philox4x32_10>;
 
 using parallel_engines =
     boost::mpl::list<trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
                      trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
                      trng::mrg5s,  //
                      trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
-                     trng::yarn5s>;
+                     trng::yarn5s, trng::lcg64_shift_simd<4>, trng::philox4x32_10>;
+
+using jump_engines =
+    boost::mpl::list<trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
+                     trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                     trng::mrg5s,  //
+                     trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
+                     trng::yarn5s, trng::lcg64_shift_simd<4>,                //
+                     trng::lagfib2xor_521_64, trng::lagfib4xor_521_32,       //
+                     trng::mt19937, trng::mt19937_64, trng::xoshiro256plus,  //
+                     trng::philox4x32_10>;
 
 using floats = boost::mpl::list<float, double, long double>;
 
@@ -315,8 +337,90 @@ BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------------------
 
+BOOST_AUTO_TEST_SUITE(test_suite_generate)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_generate, R, engines) {
+  // two engines with equal state
+  R r1, r2;
+  // bulk generation must yield the same sequence as repeated calls of operator()
+  for (long n : {0l, 1l, 3l, 4l, 5l, 1000l, 2021l}) {
+    std::vector<typename R::result_type> v1, v2(n), v3(n);
+    for (long i{0}; i < 2 * n; ++i)
+      v1.push_back(r1());
+    r2.generate(v2.begin(), v2.end());
+    r2.generate(v3.data(), v3.size());
+    v2.insert(v2.end(), v3.begin(), v3.end());
+    std::stringstream message;
+    message << "engines yield same values after generate(" << n << ")";
+    BOOST_TEST(v1 == v2, message.str().c_str());
+    BOOST_TEST(r1 == r2, "engines have equal state after generate");
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------------------
+
+using simd_engines =
+    boost::mpl::list<trng::lcg64_shift_simd<1>, trng::lcg64_shift_simd<2>,
+                     trng::lcg64_shift_simd<4>, trng::lcg64_shift_simd<8>>;
+
+BOOST_AUTO_TEST_SUITE(test_suite_simd)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_simd, R, simd_engines) {
+  // multi-lane engine must yield the same sequence as its scalar counterpart
+  trng::lcg64_shift r1(12345ul);
+  r1();
+  R r2(r1);
+  {
+    std::vector<typename R::result_type> v1, v2;
+    for (long i{0}; i < 1000; ++i) {
+      v1.push_back(r1());
+      v2.push_back(r2());
+    }
+    BOOST_TEST(v1 == v2, "engines yield same values");
+  }
+  r1.split(7, 3);
+  r2.split(7, 3);
+  BOOST_TEST((R(r1) == r2), "engines have equal state after split");
+  {
+    std::vector<typename R::result_type> v1, v2;
+    for (long i{0}; i < 1000; ++i) {
+      v1.push_back(r1());
+      v2.push_back(r2());
+    }
+    BOOST_TEST(v1 == v2, "engines yield same values after split");
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(test_suite_philox)
+BOOST_AUTO_TEST_CASE(test_philox) {
+  // known answer for key 0 and counter 0 from the Random123 test vectors
+  const std::vector<trng::philox4x32_10::result_type> known{0x6627e8d5u, 0xe169c58du,
+                                                            0xbc57ac4cu, 0x9b00dbd8u};
+  std::vector<trng::philox4x32_10::result_type> v1, v2, v3(4);
+  trng::philox4x32_10 r1, r2;
+  for (unsigned long long i{0}; i < 4; ++i) {
+    v1.push_back(r1());
+    v2.push_back(trng::philox4x32_10::at(0, i));
+  }
+  r2.generate(v3.begin(), v3.end());
+  BOOST_TEST(v1 == known, "engine yields known answer");
+  BOOST_TEST(v2 == known, "stateless access yields known answer");
+  BOOST_TEST(v3 == known, "bulk generation yields known answer");
+  // random access agrees with sequential generation for an arbitrary key
+  trng::philox4x32_10 r3(271828ull);
+  bool equal{true};
+  for (unsigned long long i{0}; i < 1000; ++i)
+    equal = equal and r3() == trng::philox4x32_10::at(271828ull, i);
+  BOOST_TEST(equal, "stateless access agrees with sequential generation");
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE(test_suite_jump2)
-BOOST_AUTO_TEST_CASE_TEMPLATE(test_jump2, R, parallel_engines) {
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_jump2, R, jump_engines) {
   // two engines with equal state
   R r1, r2;
   long n{1l};
@@ -354,6 +458,134 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_split, R, parallel_engines) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_split_streams, R, parallel_engines) {
+  R r;
+  advance_engine(r, 271828l);
+  for (unsigned int i : {1u, 2u, 3u, 17u, 64u}) {
+    const std::vector<R> streams{trng::make_split_streams(r, i)};
+    bool equal{streams.size() == i};
+    for (unsigned int j{0}; j < i and equal; ++j) {
+      R r1 = r;
+      r1.split(i, j);
+      equal = r1 == streams[j];
+    }
+    std::stringstream message;
+    message << "split streams equal split engines for " << i << " streams";
+    BOOST_TEST(equal, message.str().c_str());
+  }
+}
+
+using lcg64_engines =
+    boost::mpl::list<trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_stream_pool, R, lcg64_engines) {
+  R r;
+  advance_engine(r, 271828l);
+  const unsigned int s{17};
+  trng::lcg64_stream_pool<R> pool(r, s);
+  std::vector<R> streams;
+  for (unsigned int j{0}; j < s; ++j) {
+    streams.push_back(r);
+    streams.back().split(s, j);
+  }
+  bool equal{pool.size() == s};
+  for (unsigned int j{0}; j < s; ++j)
+    equal = equal and pool.engine(j) == streams[j];
+  BOOST_TEST(equal, "pool streams equal split engines");
+  // one number of each stream
+  std::vector<typename R::result_type> v(s);
+  pool.generate(v.begin());
+  equal = true;
+  for (unsigned int j{0}; j < s; ++j)
+    equal = equal and v[j] == streams[j]();
+  BOOST_TEST(equal, "pool yields same values as split engines for all streams");
+  // numbers of a single stream
+  std::vector<typename R::result_type> w(s);
+  pool.generate(3, v.begin(), v.end());
+  streams[3].generate(w.begin(), w.end());
+  BOOST_TEST((v == w and pool(3) == streams[3]()),
+             "pool yields same values as split engine for single stream");
+}
+
+using mrg_engines = boost::mpl::list<trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                                     trng::mrg5s,  //
+                                     trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4,
+                                     trng::yarn5, trng::yarn5s>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_stream_array, R, mrg_engines) {
+  R r;
+  advance_engine(r, 271828l);
+  const unsigned int s{37};
+  std::vector<R> streams{trng::make_split_streams(r, s)};
+  trng::stream_array<R> array(streams.begin(), streams.end());
+  bool equal{array.size() == s};
+  for (unsigned int j{0}; j < s; ++j)
+    equal = equal and array.engine(j) == streams[j];
+  BOOST_TEST(equal, "array streams equal engines");
+  // one number of each stream per call
+  std::vector<typename R::result_type> v(s);
+  equal = true;
+  for (int k{0}; k < 100; ++k) {
+    array.generate(v.begin());
+    for (unsigned int j{0}; j < s; ++j)
+      equal = equal and v[j] == streams[j]();
+  }
+  BOOST_TEST(equal, "array yields same values as engines for all streams");
+  // advance all streams, replace a single stream
+  array.discard(1001);
+  for (auto &stream : streams)
+    stream.discard(1001);
+  streams[5] = r;
+  array.set(5, r);
+  array.generate(v.begin());
+  equal = true;
+  for (unsigned int j{0}; j < s; ++j)
+    equal = equal and v[j] == streams[j]() and array.engine(j) == streams[j];
+  BOOST_TEST(equal, "array streams equal engines after discard and set");
+}
+
+using harvest_engines = boost::mpl::list<trng::lcg64_shift, trng::mt19937, trng::mt19937_64>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_bit_harvester, R, harvest_engines) {
+  R r;
+  advance_engine(r, 271828l);
+  trng::bit_harvester<R> h(r);
+  // engine output is consumed from the most significant bit downwards, also by requests
+  // that span two engine outputs
+  const int w{std::numeric_limits<typename R::result_type>::digits};
+  std::vector<bool> b1, b2;
+  for (int i{0}; i < 2 * w; ++i)
+    b1.push_back(h.bit());
+  for (int i{0}; i < w; ++i) {
+    const uint32_t x{h.bits(29)};
+    for (int j{28}; j >= 0; --j)
+      b1.push_back(((x >> j) & 1u) == 1u);
+  }
+  for (int i{0}; i < 2 + 29; ++i) {
+    const typename R::result_type x{r()};
+    for (int j{w - 1}; j >= 0; --j)
+      b2.push_back(((x >> j) & 1u) == 1u);
+  }
+  BOOST_TEST((b1 == b2 and h.base() == r), "bits consumed in documented order");
+  // numbers of uniform01_dist<float> take 24 bits each
+  trng::uniform01_dist<float> u;
+  for (int i{0}; i < w; ++i)
+    u(h);
+  advance_engine(r, 24l);
+  BOOST_TEST((h.base() == r), "uniform01_dist<float> takes 24 bits");
+  // bernoulli_dist and uniform_int_dist
+  trng::bernoulli_dist<int> b(0.25, 1, 0);
+  trng::uniform_int_dist d(-3, 4);
+  const int N{100000};
+  int heads{0}, sum{0};
+  for (int i{0}; i < N; ++i) {
+    heads += b(h);
+    sum += d(h);
+  }
+  BOOST_TEST(std::abs(heads - N / 4) < 1000);
+  BOOST_TEST(std::abs(sum) < 2000);
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------------------
@@ -135,6 +135,65 @@ BOOST_AUTO_TEST_CASE(test_matrix_mult) {
   BOOST_TEST(ok, "modular matrix-matrix multiplication");
 }
 
+BOOST_AUTO_TEST_CASE(test_block_matrix) {
+  const int n{3};
+  const int k{4};
+  const trng::int32_t a[n]{1, 2, 3};
+  trng::int32_t r[n]{2, 3, 4};
+  constexpr trng::int32_t m{7};
+  trng::int32_t c[k * n], x[k];
+  const trng::int32_t x_exact[k]{6, 5, 2, 2};
+  const trng::int32_t r_exact[n]{2, 5, 6};
+  trng::int_math::block_matrix<n, k>(a, c, m);
+  trng::int_math::block_vec_mult<m, n, k>(c, r, x);
+  bool ok{true};
+  for (int i{0}; i < k; ++i)
+    ok = ok and (x[i] == x_exact[i]);
+  BOOST_TEST(ok, "block-lookahead of modular linear recurrence");
+  trng::int_math::block_update<n, k>(r, x, 3);
+  ok = true;
+  for (int i{0}; i < n; ++i)
+    ok = ok and (r[i] == r_exact[i]);
+  BOOST_TEST(ok, "state update by block-lookahead values");
+}
+
+BOOST_AUTO_TEST_CASE(test_jump_table) {
+  const int n{3};
+  const trng::int32_t a[n]{1, 2, 3};
+  const trng::int32_t m{7};
+  const auto A(trng::int_math::jump_table<n>::get(a, m));
+  BOOST_TEST((A == trng::int_math::jump_table<n>::get(a, m)), "jump tables are shared");
+  bool ok{true};
+  for (int i{1}; i < trng::int_math::jump_table<n>::size; ++i) {
+    trng::int32_t C[n * n];
+    trng::int_math::matrix_mult<n>((*A)[i - 1], (*A)[i - 1], C, m);
+    for (int j{0}; j < n * n; ++j)
+      ok = ok and (C[j] == (*A)[i][j]);
+  }
+  BOOST_TEST(ok, "jump table holds powers of two of the companion matrix");
+}
+
+BOOST_AUTO_TEST_CASE(test_power) {
+  constexpr trng::int32_t m{2147483647}, b{123567893};
+  const trng::int_math::power<m, b> g16;
+  const trng::int_math::power<m, b, 11> g11;
+  const trng::int32_t n[4]{0, 1, 65536, 2147483646};
+  trng::int32_t y[4];
+  g11(n, y, 4);
+  bool ok{true};
+  for (int i{0}; i < 4; ++i) {
+    // b^n mod m by binary exponentiation
+    trng::int64_t p{1}, t{b};
+    for (trng::int32_t e{n[i]}; e > 0; e /= 2) {
+      if ((e & 0x1) == 0x1)
+        p = (p * t) % m;
+      t = (t * t) % m;
+    }
+    ok = ok and g16(n[i]) == p and g11(n[i]) == p and y[i] == p;
+  }
+  BOOST_TEST(ok, "table based modular exponentiation");
+}
+
 BOOST_AUTO_TEST_CASE(test_gauss) {
   const int n{3};
   // clang-format off
@@ -160,6 +160,66 @@ BOOST_AUTO_TEST_CASE(test_matrix_power) {
   const bool ok{A_8_2 == A_8};
   BOOST_TEST(ok, "matrix matrix power in GF2 ok");
 }
+
+BOOST_AUTO_TEST_CASE(test_packed_matrix_power) {
+  // dimension exceeds the word size and is not a multiple of eight
+  const std::size_t n{83};
+  auto f = [](std::size_t i, std::size_t j) -> bool { return (i * 7 + j * j * 3) % 5 < 2; };
+  auto g = [&](std::size_t i, std::size_t j) -> trng::GF2 { return trng::GF2(f(i, j)); };
+  const trng::GF2_matrix<n> A(f);
+  const trng::matrix<trng::GF2, n> B(g);
+  const auto A_13 = trng::power(A, 13);
+  const auto B_13 = trng::power(B, 13);
+  bool ok{true};
+  for (std::size_t i{0}; i < n; ++i)
+    for (std::size_t j{0}; j < n; ++j)
+      ok = ok and (A_13(i, j) == static_cast<bool>(B_13(i, j)));
+  BOOST_TEST(ok, "packed matrix matrix power in GF2 ok");
+}
+
+BOOST_AUTO_TEST_CASE(test_polynomial_modulo) {
+  // z^3 + z + 1 is primitive, powers of z have period 7
+  const std::size_t t[1]{1};
+  const trng::GF2_polynomial_modulo<3, 1> p(t);
+  auto coefficients = [](bool c0, bool c1, bool c2) {
+    trng::GF2_vector<3> c;
+    c.set(0, c0);
+    c.set(1, c1);
+    c.set(2, c2);
+    return c;
+  };
+  BOOST_TEST((p.power(2) == coefficients(false, false, true)), "z^2 mod p(z) = z^2");
+  BOOST_TEST((p.power(3) == coefficients(true, true, false)), "z^3 mod p(z) = z + 1");
+  BOOST_TEST((p.power(7) == coefficients(true, false, false)), "z^7 mod p(z) = 1");
+  BOOST_TEST((p.power(7 * 1000003 + 5) == p.power(5)), "z^m mod p(z) is periodic");
+  BOOST_TEST((p.power2(3) == coefficients(false, true, false)), "z^8 mod p(z) = z");
+}
+
+BOOST_AUTO_TEST_CASE(test_packed_matrix_vector) {
+  const std::size_t n{83};
+  auto f = [](std::size_t i, std::size_t j) -> bool { return (i * 7 + j * j * 3) % 5 < 2; };
+  auto h = [](std::size_t i) -> bool { return i % 3 == 1; };
+  auto w = [](std::size_t i) -> std::uint32_t { return std::uint32_t(i * 2654435761u); };
+  const trng::GF2_matrix<n> A(f);
+  const trng::GF2_vector<n> v(h);
+  const trng::vector<std::uint32_t, n> u(w);
+  const auto Av = A * v;
+  const auto Au = A * u;
+  bool ok_v{true}, ok_u{true};
+  for (std::size_t i{0}; i < n; ++i) {
+    bool sum_v{false};
+    std::uint32_t sum_u{0};
+    for (std::size_t k{0}; k < n; ++k)
+      if (f(i, k)) {
+        sum_v = sum_v != h(k);
+        sum_u ^= w(k);
+      }
+    ok_v = ok_v and (Av(i) == sum_v);
+    ok_u = ok_u and (Au(i) == sum_u);
+  }
+  BOOST_TEST(ok_v, "packed matrix vector product in GF2 ok");
+  BOOST_TEST(ok_u, "packed matrix times bit-sliced words ok");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------------------
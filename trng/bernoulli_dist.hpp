@@ -44,6 +44,9 @@
 
 namespace trng {
 
+  template<typename R>
+  class bit_harvester;
+
   // non-uniform random number generator class
   template<typename T>
   class bernoulli_dist {
@@ -159,6 +162,11 @@ namespace trng {
     TRNG_CUDA_ENABLE T operator()(R &r) {
       return utility::uniformco<double>(r) < P.p() ? P.head() : P.tail();
     }
+    // takes typically 8 bits of a bit_harvester
+    template<typename R>
+    T operator()(bit_harvester<R> &r) {
+      return r.bernoulli(P.p()) ? P.head() : P.tail();
+    }
     template<typename R>
     TRNG_CUDA_ENABLE T operator()(R &r, const param_type &P) {
       bernoulli_dist g(P);
@@ -40,6 +40,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -48,8 +49,15 @@
 
 namespace trng {
 
+  // sampling methods of beta_dist in addition to inversion_tag
+
+  // rejection methods BB for min(alpha, beta) > 1 and BC for min(alpha, beta) <= 1 by
+  // Cheng, take two uniform random numbers per trial, the expected number of trials is
+  // below 1.2 for BB and below 4 for BC, host only
+  struct cheng_tag {};
+
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = inversion_tag>
   class beta_dist {
   public:
     using result_type = float_t;
@@ -138,8 +146,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return math::inv_Beta_I(utility::uniformoo<result_type>(r), P.alpha(), P.beta(),
-                              P.norm());
+      return sample(r, method_t());
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
@@ -196,27 +203,125 @@ namespace trng {
         return 1;
       return math::inv_Beta_I(x, P.alpha(), P.beta(), P.norm());
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, inversion_tag) {
+      return math::inv_Beta_I(utility::uniformoo<result_type>(r), P.alpha(), P.beta(),
+                              P.norm());
+    }
+
+    template<typename R>
+    result_type sample(R &r, cheng_tag) {
+      return (P.alpha() < P.beta() ? P.alpha() : P.beta()) > 1 ? cheng_bb(r) : cheng_bc(r);
+    }
+
+    // ln(b0 + a0 * exp(v)) without overflow, ln_a0 = ln(a0)
+    static result_type ln_b0_plus_w(result_type ln_a0, result_type b0, result_type v) {
+      const result_type ln_w{ln_a0 + v}, ln_b0{math::ln(b0)};
+      return ln_w > ln_b0 ? ln_w + math::ln1p(math::exp(ln_b0 - ln_w))
+                          : ln_b0 + math::ln1p(math::exp(ln_w - ln_b0));
+    }
+
+    // w / (b0 + w) with w = a0 * exp(v), or its complement b0 / (b0 + w) if first is false;
+    // exp may overflow to infinity but the quotient is always well defined
+    static result_type w_ratio(bool first, result_type a0, result_type b0, result_type v) {
+      return first ? 1 / (1 + (b0 / a0) * math::exp(-v)) : 1 / (1 + (a0 / b0) * math::exp(v));
+    }
+
+    // algorithm BB, a0 = min(alpha, beta) > 1
+    template<typename R>
+    result_type cheng_bb(R &r) const {
+      const bool alpha_min{P.alpha() < P.beta()};
+      const result_type a0{alpha_min ? P.alpha() : P.beta()};
+      const result_type b0{alpha_min ? P.beta() : P.alpha()};
+      const result_type s0{a0 + b0};
+      const result_type b{math::sqrt((s0 - 2) / (2 * a0 * b0 - s0))}, c{a0 + 1 / b};
+      const result_type ln_4{2 * math::constants<result_type>::ln_2};
+      const result_type one_plus_ln_5{result_type(2.6094379124341003746)};
+      const result_type ln_a0{math::ln(a0)}, ln_s0{math::ln(s0)};
+      result_type v;
+      while (true) {
+        const result_type u1{utility::uniformoo<result_type>(r)};
+        const result_type u2{utility::uniformoo<result_type>(r)};
+        v = b * math::ln(u1 / (1 - u1));
+        // w may overflow to infinity, then both squeezes fail and the exact test decides
+        const result_type w{a0 * math::exp(v)};
+        const result_type z{u1 * u1 * u2};
+        const result_type t{c * v - ln_4};
+        const result_type s{a0 + t - w};
+        // squeeze
+        if (s + one_plus_ln_5 >= 5 * z)
+          break;
+        const result_type ln_z{math::ln(z)};
+        if (s > ln_z)
+          break;
+        if (t + s0 * (ln_s0 - ln_b0_plus_w(ln_a0, b0, v)) >= ln_z)
+          break;
+      }
+      return w_ratio(alpha_min, a0, b0, v);
+    }
+
+    // algorithm BC, b0 = min(alpha, beta) <= 1
+    template<typename R>
+    result_type cheng_bc(R &r) const {
+      const bool alpha_max{P.alpha() > P.beta()};
+      const result_type a0{alpha_max ? P.alpha() : P.beta()};
+      const result_type b0{alpha_max ? P.beta() : P.alpha()};
+      const result_type s0{a0 + b0};
+      const result_type b{1 / b0}, delta{1 + a0 - b0};
+      const result_type k1{delta * (result_type(1) / result_type(72) + b0 / 24) /
+                           (a0 * b - result_type(7) / result_type(9))};
+      const result_type k2{result_type(1) / result_type(4) +
+                           (result_type(1) / result_type(2) + 1 / (4 * delta)) * b0};
+      const result_type ln_4{2 * math::constants<result_type>::ln_2};
+      const result_type ln_a0{math::ln(a0)}, ln_s0{math::ln(s0)};
+      result_type v;
+      while (true) {
+        const result_type u1{utility::uniformoo<result_type>(r)};
+        const result_type u2{utility::uniformoo<result_type>(r)};
+        result_type z;
+        if (u1 < result_type(1) / result_type(2)) {
+          const result_type y{u1 * u2};
+          z = u1 * y;
+          if (u2 / 4 + z - y >= k1)
+            continue;
+        } else {
+          z = u1 * u1 * u2;
+          if (z <= result_type(1) / result_type(4)) {
+            v = b * math::ln(u1 / (1 - u1));
+            break;
+          }
+          if (z >= k2)
+            continue;
+        }
+        v = b * math::ln(u1 / (1 - u1));
+        if (s0 * (ln_s0 - ln_b0_plus_w(ln_a0, b0, v) + v) - ln_4 >= math::ln(z))
+          break;
+      }
+      return w_ratio(alpha_max, a0, b0, v);
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const beta_dist<float_t> &g1,
-                                          const beta_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const beta_dist<float_t, method_t> &g1,
+                                          const beta_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const beta_dist<float_t> &g1,
-                                          const beta_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const beta_dist<float_t, method_t> &g1,
+                                          const beta_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const beta_dist<float_t> &g) {
+                                                   const beta_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[beta " << g.param() << ']';
@@ -224,10 +329,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   beta_dist<float_t> &g) {
-    typename beta_dist<float_t>::param_type P;
+                                                   beta_dist<float_t, method_t> &g) {
+    typename beta_dist<float_t, method_t>::param_type P;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[beta ") >> P >> utility::delim(']');
@@ -37,6 +37,7 @@
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
+#include <trng/constants.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -45,6 +46,56 @@
 
 namespace trng {
 
+  namespace detail {
+
+    // Stirling correction ln(k!) - ((k + 1/2) ln(k + 1) - (k + 1) + ln(2 pi) / 2)
+    inline double stirling_correction(int k) {
+      static constexpr double table[16]{
+          0.081061466795327258,  0.041340695955409294, 0.027677925684998339,
+          0.020790672103765093,  0.016644691189821192, 0.013876128823070748,
+          0.01189670994589177,   0.010411265261972097, 0.009255462182712732,
+          0.0083305634333628725, 0.0075736754879518423, 0.0069428401072095299,
+          0.0064089941880042054, 0.0059513701127588484, 0.0055547335519628011,
+          0.0052076559196096387};
+      if (k < 16)
+        return table[k];
+      const double r{1.0 / (k + 1)}, rr{r * r};
+      return (1.0 / 12 - (1.0 / 360 - (1.0 / 1260 - (1.0 / 1680 - rr / 1188) * rr) * rr) * rr) *
+             r;
+    }
+
+    // deviance term x ln(x / y) + y - x, accurate for x close to y
+    inline double deviance(double x, double y) {
+      if (math::abs(x - y) < 0.1 * (x + y)) {
+        const double v{(x - y) / (x + y)}, v2{v * v};
+        double s{(x - y) * v}, t{2 * x * v};
+        for (int j{1};; ++j) {
+          t *= v2;
+          const double s_new{s + t / (2 * j + 1)};
+          if (s_new == s)
+            return s;
+          s = s_new;
+        }
+      }
+      return x * math::ln(x / y) + y - x;
+    }
+
+    // logarithm of the probability of x for the binomial distribution with parameters p and
+    // n by the saddle point expansion of Loader, avoids the cancellation of ln(n!) and
+    // ln(x!) + ln((n - x)!) for large n
+    inline double ln_binomial_pdf(int x, int n, double p) {
+      if (x == 0)
+        return n * math::ln(1 - p);
+      if (x == n)
+        return n * math::ln(p);
+      return stirling_correction(n - 1) - stirling_correction(x - 1) -
+             stirling_correction(n - x - 1) - deviance(x, n * p) -
+             deviance(n - x, n * (1 - p)) +
+             math::ln(n / (2 * math::constants<double>::pi * x * (n - x))) / 2;
+    }
+
+  }  // namespace detail
+
   // non-uniform random number generator class
   class binomial_dist {
   public:
@@ -52,91 +103,251 @@ namespace trng {
 
     class param_type {
     private:
+      // smallest n * min(p, 1 - p) for which random numbers are generated by transformed
+      // rejection instead of sequential inversion if no table is available
+      static constexpr double m_btrd{10};
+
       double p_{0.5};
       int n_{0};
-      std::vector<double> P_;
-
-      void calc_probabilities() {
-        P_ = std::vector<double>();
-        P_.reserve(n_ + 1);
-        double ln_binom{0.0};
-        const double ln_p{math::ln(p_)};
-        const double ln_1_p{math::ln(1.0 - p_)};
-        for (int i{0}; i <= n_; ++i) {
-          const double ln_prob{ln_binom + static_cast<double>(i) * ln_p +
-                               static_cast<double>(n_ - i) * ln_1_p};
-          P_.push_back(math::exp(ln_prob));
-          ln_binom += math::ln(static_cast<double>(n_ - i));
-          ln_binom -= math::ln(static_cast<double>(i + 1));
-        }
-        // build list with cumulative density function
-        for (std::vector<double>::size_type i{1}; i < P_.size(); ++i)
-          P_[i] += P_[i - 1];
-        // normailze, just in case of rounding errors
-        for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
-          P_[i] /= P_.back();
+      // parameters of the sampling methods without table, in terms of p' = min(p, 1 - p),
+      // random numbers are mirrored if p' differs from p
+      bool mirror_{false};
+      double p_min_{0}, r_{0}, nr_{0}, npq_{0}, f0_{1}, a_{0}, b_{0}, c_{0}, alpha_{0}, v_r_{0};
+      int m_{0};
+
+      void calc_parameters() {
+        mirror_ = p_ > 0.5;
+        p_min_ = mirror_ ? 1 - p_ : p_;
+        r_ = p_min_ / (1 - p_min_);
+        nr_ = (n_ + 1) * r_;
+        npq_ = n_ * p_min_ * (1 - p_min_);
+        m_ = static_cast<int>(math::floor((n_ + 1) * p_min_));
+        if (n_ * p_min_ >= m_btrd) {
+          const double sqrt_npq{math::sqrt(npq_)};
+          b_ = 1.15 + 2.53 * sqrt_npq;
+          a_ = -0.0873 + 0.0248 * b_ + 0.01 * p_min_;
+          c_ = n_ * p_min_ + 0.5;
+          alpha_ = (2.83 + 5.1 / b_) * sqrt_npq;
+          v_r_ = 0.92 - 4.2 / b_;
+        } else
+          // probability of zero
+          f0_ = math::exp(n_ * math::ln(1 - p_min_));
       }
 
     public:
       double p() const { return p_; }
       void p(double p_new) {
         p_ = p_new;
-        calc_probabilities();
+        calc_parameters();
       }
       int n() const { return n_; }
       void n(int n_new) {
         n_ = n_new;
-        calc_probabilities();
+        calc_parameters();
       }
       param_type() = default;
-      explicit param_type(double p, int n) : p_(p), n_(n) { calc_probabilities(); }
+      explicit param_type(double p, int n) : p_(p), n_(n) { calc_parameters(); }
       friend class binomial_dist;
     };
 
   private:
+    // largest n for which random numbers are generated by inversion of a table of the
+    // cumulative distribution function, for larger n the distribution is sampled with
+    // constant memory, for n * min(p, 1 - p) >= 10 by transformed rejection, otherwise
+    // by sequential inversion
+    static constexpr int n_table{1024};
+
     param_type P;
+    // cumulative density function for small n, the table is owned by the distribution and
+    // not by its parameters such that parameters are cheap to construct and to copy
+    std::vector<double> P_;
+
+    void calc_probabilities() {
+      P_ = std::vector<double>();
+      if (P.n() > n_table)
+        return;
+      P_.reserve(P.n() + 1);
+      double ln_binom{0.0};
+      const double ln_p{math::ln(P.p())};
+      const double ln_1_p{math::ln(1.0 - P.p())};
+      for (int i{0}; i <= P.n(); ++i) {
+        const double ln_prob{ln_binom + static_cast<double>(i) * ln_p +
+                             static_cast<double>(P.n() - i) * ln_1_p};
+        P_.push_back(math::exp(ln_prob));
+        ln_binom += math::ln(static_cast<double>(P.n() - i));
+        ln_binom -= math::ln(static_cast<double>(i + 1));
+      }
+      // build list with cumulative density function
+      for (std::vector<double>::size_type i{1}; i < P_.size(); ++i)
+        P_[i] += P_[i - 1];
+      // normailze, just in case of rounding errors
+      for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
+        P_[i] /= P_.back();
+    }
 
   public:
     // constructor
-    explicit binomial_dist(double p, int n) : P{p, n} {}
-    explicit binomial_dist(const param_type &P) : P{P} {}
+    explicit binomial_dist(double p, int n) : P{p, n} { calc_probabilities(); }
+    explicit binomial_dist(const param_type &P) : P{P} { calc_probabilities(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (P_.empty())
+        return sample(r, P);
       return static_cast<int>(
-          utility::discrete(utility::uniformoo<double>(r), P.P_.begin(), P.P_.end()));
+          utility::discrete(utility::uniformoo<double>(r), P_.begin(), P_.end()));
     }
+    // random numbers for parameters that may change from call to call, needs neither a
+    // table nor memory allocations
     template<typename R>
     int operator()(R &r, const param_type &P) {
-      binomial_dist g(P);
-      return g(r);
+      return sample(r, P);
     }
     // property methods
     int min() const { return 0; }
     int max() const { return P.n(); }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      calc_probabilities();
+    }
     double p() const { return P.p(); }
-    void p(double p_new) { P.p(p_new); }
+    void p(double p_new) {
+      P.p(p_new);
+      calc_probabilities();
+    }
     int n() const { return P.n(); }
-    void n(int n_new) { P.n(n_new); }
+    void n(int n_new) {
+      P.n(n_new);
+      calc_probabilities();
+    }
     // probability density function
     double pdf(int x) const {
       if (x < 0 or x > P.n())
         return 0.0;
+      if (P_.empty())
+        return math::exp(detail::ln_binomial_pdf(x, P.n(), P.p()));
       if (x == 0)
-        return P.P_[0];
-      return P.P_[x] - P.P_[x - 1];
+        return P_[0];
+      return P_[x] - P_[x - 1];
     }
     // cumulative density function
     double cdf(int x) const {
       if (x < 0)
         return 0.0;
-      if (x <= P.n())
-        return P.P_[x];
-      return 1.0;
+      if (x >= P.n())
+        return 1.0;
+      if (P_.empty()) {
+        // sum of the probabilities of the tail that does not contain the mean, probabilities
+        // decrease in the direction of summation once beyond the mode
+        const double ratio{P.p() / (1 - P.p())};
+        const double eps{math::numeric_limits<double>::epsilon()};
+        double sum{0};
+        if (x < P.n() * P.p()) {
+          double f{pdf(x)};
+          for (int i{x}; i >= 0 and f > eps * sum; --i) {
+            sum += f;
+            f *= i / ((P.n() - i + 1) * ratio);
+          }
+          return sum;
+        }
+        double f{pdf(x + 1)};
+        for (int i{x + 1}; i <= P.n() and f > eps * sum; ++i) {
+          sum += f;
+          f *= (P.n() - i) * ratio / (i + 1);
+        }
+        return 1 - sum;
+      }
+      return P_[x];
+    }
+
+  private:
+    // sampling without table
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      const int x{P.n() * P.p_min_ >= param_type::m_btrd ? btrd(r, P) : binv(r, P)};
+      return P.mirror_ ? P.n() - x : x;
+    }
+
+    // transformed rejection with decomposition (BTRD) by Hoermann for n p' >= 10, about 1.1
+    // trials per random number, most trials are accepted by a single uniform random number
+    // without evaluating transcendental functions
+    template<typename R>
+    static int btrd(R &r, const param_type &P) {
+      const int n{P.n()}, m{P.m_};
+      const double a{P.a_}, b{P.b_}, c{P.c_}, v_r{P.v_r_}, nr{P.nr_}, ratio{P.r_};
+      while (true) {
+        double v{utility::uniformco<double>(r)}, u;
+        if (v <= 0.86 * v_r) {
+          u = v / v_r - 0.43;
+          return static_cast<int>(math::floor((2 * a / (0.5 - math::abs(u)) + b) * u + c));
+        }
+        if (v >= v_r)
+          u = utility::uniformco<double>(r) - 0.5;
+        else {
+          u = v / v_r - 0.93;
+          u = (u < 0 ? -0.5 : 0.5) - u;
+          v = utility::uniformco<double>(r) * v_r;
+        }
+        const double us{0.5 - math::abs(u)};
+        const double k_d{math::floor((2 * a / us + b) * u + c)};
+        if (k_d < 0 or k_d > n)
+          continue;
+        const int k{static_cast<int>(k_d)};
+        v *= P.alpha_ / (a / (us * us) + b);
+        const int km{k > m ? k - m : m - k};
+        if (km <= 15) {
+          // recursive evaluation of f(k) / f(m)
+          double f{1};
+          if (m < k) {
+            for (int i{m + 1}; i <= k; ++i)
+              f *= nr / i - ratio;
+          } else {
+            for (int i{k + 1}; i <= m; ++i)
+              v *= nr / i - ratio;
+          }
+          if (v <= f)
+            return k;
+          continue;
+        }
+        // squeeze by bounds of ln(f(k) / f(m))
+        v = math::ln(v);
+        const double rho{(km / P.npq_) *
+                         (((km / 3.0 + 0.625) * km + 1.0 / 6) / P.npq_ + 0.5)};
+        const double t{-0.5 * km * km / P.npq_};
+        if (v < t - rho)
+          return k;
+        if (v > t + rho)
+          continue;
+        const double nm{n - m + 1.0}, nk{n - k + 1.0};
+        const double h{(m + 0.5) * math::ln((m + 1) / (ratio * nm)) +
+                       detail::stirling_correction(m) + detail::stirling_correction(n - m)};
+        if (v <= h + (n + 1) * math::ln(nm / nk) + (k + 0.5) * math::ln(nk * ratio / (k + 1)) -
+                     detail::stirling_correction(k) - detail::stirling_correction(n - k))
+          return k;
+      }
+    }
+
+    // sequential inversion starting at zero for n p' < 10, takes one uniform random number
+    // and about n p' + 1 steps per random number
+    template<typename R>
+    static int binv(R &r, const param_type &P) {
+      double u{utility::uniformoo<double>(r)}, f{P.f0_};
+      int x{0};
+      while (u > f) {
+        u -= f;
+        ++x;
+        f *= P.nr_ / x - P.r_;
+        // u exceeds the sum of all probabilities due to rounding errors, start over
+        if (f == 0 or x > P.n()) {
+          u = utility::uniformoo<double>(r);
+          f = P.f0_;
+          x = 0;
+        }
+      }
+      return x;
     }
   };
 
@@ -0,0 +1,231 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_BIT_HARVESTER_HPP)
+
+#define TRNG_BIT_HARVESTER_HPP
+
+#include <trng/limits.hpp>
+#include <trng/math.hpp>
+#include <trng/utility.hpp>
+#include <trng/uniformxx.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <ciso646>
+
+namespace trng {
+
+  // adaptor that splits the output of an engine into chunks of bits, such that a single
+  // engine call may serve several narrow random variates, the range of the engine R must
+  // be [0, 2^k) with k >= 1
+  //
+  // consumption order: every engine output is consumed from its most significant bit to
+  // its least significant bit, bits(n) returns the next n bits as an integer whose most
+  // significant bit is the first bit consumed, a request that exceeds the bits left of the
+  // current engine output takes these first and continues with the next engine output
+  //
+  // random numbers of uniform01_dist<float_t> take as many bits as float_t has binary
+  // digits, bernoulli_dist compares chunks of 8 bits with the binary expansion of p, and
+  // uniform_int_dist takes the number of bits of the largest value b - a - 1 per trial of
+  // a rejection method
+  template<typename R>
+  class bit_harvester {
+  public:
+    using engine_type = R;
+    using result_type = uint32_t;
+
+  private:
+    using engine_result_type = typename R::result_type;
+    static constexpr int engine_bits{utility::Bits<R::max()>::result};
+    static_assert(R::min() == 0 and utility::Holes<R::max()>::result == 0,
+                  "engine range must be [0, 2^k)");
+    static_assert(engine_bits <= 64, "engine range too large");
+
+  public:
+    // constructors
+    bit_harvester() = default;
+    explicit bit_harvester(const R &r) : r{r} {}
+
+    // Uniform random number generator concept
+    result_type operator()() { return bits(32); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~static_cast<result_type>(0); }
+
+    // next n bits, 0 <= n <= 32
+    result_type bits(int n) {
+      if (n <= left) {
+        left -= n;
+        return static_cast<result_type>((word >> left) & mask(n));
+      }
+      return bits_refill(n);
+    }
+
+    // next single bit
+    bool bit() { return bits(1) != 0; }
+
+    // true with probability p, the random number 0.b_1 b_2 b_3... given by the bits
+    // consumed is compared with the binary expansion of p chunk by chunk until they differ
+    bool bernoulli(double p) {
+      if (not(p > 0))
+        return false;
+      if (p >= 1)
+        return true;
+      while (true) {
+        p *= 256;
+        const double p_i{math::floor(p)};
+        const result_type b_i{bits(8)};
+        if (b_i != static_cast<result_type>(p_i))
+          return b_i < static_cast<result_type>(p_i);
+        p -= p_i;
+        if (p == 0)
+          return false;
+      }
+    }
+
+    // uniformly distributed integer in [0, d), d >= 1
+    result_type uniform_int(result_type d) {
+      const int n{bit_count(d - 1)};
+      while (true) {
+        const result_type x{bits(n)};
+        if (x < d)
+          return x;
+      }
+    }
+
+    // underlying engine
+    const R &base() const { return r; }
+
+    // Equality comparable concept
+    friend bool operator==(const bit_harvester &h1, const bit_harvester &h2) {
+      return h1.r == h2.r and h1.left == h2.left and
+             (h1.word & mask(h1.left)) == (h2.word & mask(h2.left));
+    }
+    friend bool operator!=(const bit_harvester &h1, const bit_harvester &h2) {
+      return not(h1 == h2);
+    }
+
+  private:
+    R r;
+    // engine output that is consumed currently, its lowest left bits are still unused
+    uint64_t word{0};
+    int left{0};
+
+    // takes the bits left, continues with further engine output
+    result_type bits_refill(int n) {
+      uint64_t x{0};
+      while (n > left) {
+        x = (x << left) | (word & mask(left));
+        n -= left;
+        word = static_cast<uint64_t>(r());
+        left = engine_bits;
+      }
+      left -= n;
+      x = (x << n) | ((word >> left) & mask(n));
+      return static_cast<result_type>(x);
+    }
+
+    static uint64_t mask(int n) {
+      return n < 64 ? (static_cast<uint64_t>(1) << n) - 1u : ~static_cast<uint64_t>(0);
+    }
+
+    // number of bits required to represent x
+    static int bit_count(result_type x) {
+      int n{0};
+      while (x > 0) {
+        x >>= 1u;
+        ++n;
+      }
+      return n;
+    }
+  };
+
+  namespace utility {
+
+    // uniform random numbers in [0, 1] etc. from the bits of a bit_harvester, a random
+    // number takes as many bits as the return type has binary digits, at most 64
+    template<typename return_type, std::size_t requested_bits, typename R>
+    class u01xx_traits<return_type, requested_bits, bit_harvester<R>> {
+      using ret_t = return_type;
+      static constexpr int digits{math::numeric_limits<ret_t>::digits};
+      static constexpr int bits{digits < 64 ? digits : 64};
+
+      // random integer with n bits as a floating point number
+      static ret_t variate(bit_harvester<R> &r, int n) {
+        if (n <= 32)
+          return static_cast<ret_t>(r.bits(n));
+        const ret_t hi{static_cast<ret_t>(r.bits(n - 32))};
+        return hi * ret_t(4294967296.0) + static_cast<ret_t>(r.bits(32));
+      }
+      // 2^bits
+      static constexpr ret_t range() {
+        return bits < 64 ? static_cast<ret_t>(1ull << (bits % 64))
+                         : ret_t(4294967296.0) * ret_t(4294967296.0);
+      }
+
+    public:
+      static return_type cc(bit_harvester<R> &r) {
+        return variate(r, bits) / (range() - ret_t(1));
+      }
+      static return_type co(bit_harvester<R> &r) { return variate(r, bits) / range(); }
+      static return_type oc(bit_harvester<R> &r) { return ret_t(1) - co(r); }
+      static return_type oo(bit_harvester<R> &r) {
+        return (ret_t(2) * variate(r, bits - 1) + ret_t(1)) / range();
+      }
+
+      // batch versions of the above
+      template<typename OutputIt>
+      static void cc(bit_harvester<R> &r, OutputIt first, OutputIt last) {
+        for (; first != last; ++first)
+          *first = cc(r);
+      }
+      template<typename OutputIt>
+      static void co(bit_harvester<R> &r, OutputIt first, OutputIt last) {
+        for (; first != last; ++first)
+          *first = co(r);
+      }
+      template<typename OutputIt>
+      static void oc(bit_harvester<R> &r, OutputIt first, OutputIt last) {
+        for (; first != last; ++first)
+          *first = oc(r);
+      }
+      template<typename OutputIt>
+      static void oo(bit_harvester<R> &r, OutputIt first, OutputIt last) {
+        for (; first != last; ++first)
+          *first = oo(r);
+      }
+    };
+
+  }  // namespace utility
+
+}  // namespace trng
+
+#endif
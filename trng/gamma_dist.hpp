@@ -39,6 +39,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
+#include <trng/normal_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -47,8 +49,16 @@
 
 namespace trng {
 
+  // sampling methods of gamma_dist in addition to inversion_tag
+
+  // squeeze-rejection method by Marsaglia and Tsang, takes a normal and a uniform random
+  // number per trial, a trial is accepted with probability above 95% for kappa >= 1, for
+  // kappa < 1 a gamma random number with shape kappa + 1 is scaled by u^(1 / kappa) with
+  // an additional uniform random number u, host only
+  struct marsaglia_tsang_tag {};
+
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = inversion_tag>
   class gamma_dist {
   public:
     using result_type = float_t;
@@ -124,6 +134,10 @@ namespace trng {
         return -math::ln(1 - x) * P.theta();
       const result_type ln_Gamma_kappa{math::ln_Gamma(P.kappa())};
       result_type y{P.kappa()}, y_old;
+      // for kappa < 1 the iteration may diverge when started at kappa, start at the solution
+      // of the leading term of the series of GammaP instead
+      if (P.kappa() < 1)
+        y = math::exp((math::ln(x) + math::ln_Gamma(P.kappa() + 1)) / P.kappa());
       int num_iterations{0};
       do {
         ++num_iterations;
@@ -149,7 +163,7 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return icdf_(utility::uniformco<result_type>(r));
+      return sample(r, method_t());
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &p) {
@@ -204,27 +218,66 @@ namespace trng {
         return math::numeric_limits<result_type>::infinity();
       return icdf_(x);
     }
+
+  private:
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, inversion_tag) {
+      return icdf_(utility::uniformco<result_type>(r));
+    }
+
+    template<typename R>
+    result_type sample(R &r, marsaglia_tsang_tag) {
+      if (P.kappa() < 1) {
+        const result_type u{utility::uniformoo<result_type>(r)};
+        return marsaglia_tsang(r, P.kappa() + 1) * math::exp(math::ln(u) / P.kappa()) *
+               P.theta();
+      }
+      return marsaglia_tsang(r, P.kappa()) * P.theta();
+    }
+
+    // gamma random number with shape kappa >= 1 and unit scale
+    template<typename R>
+    static result_type marsaglia_tsang(R &r, result_type kappa) {
+      normal_dist<result_type, ziggurat_tag> N(0, 1);
+      const result_type d{kappa - result_type(1) / result_type(3)};
+      const result_type c{1 / math::sqrt(9 * d)};
+      while (true) {
+        result_type x, v;
+        do {
+          x = N(r);
+          v = 1 + c * x;
+        } while (v <= 0);
+        v = v * v * v;
+        const result_type u{utility::uniformoo<result_type>(r)};
+        const result_type x2{x * x};
+        // squeeze
+        if (u < 1 - result_type(0.0331) * x2 * x2)
+          return d * v;
+        if (math::ln(u) < x2 / 2 + d * (1 - v + math::ln(v)))
+          return d * v;
+      }
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const gamma_dist<float_t> &g1,
-                                          const gamma_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const gamma_dist<float_t, method_t> &g1,
+                                          const gamma_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const gamma_dist<float_t> &g1,
-                                          const gamma_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const gamma_dist<float_t, method_t> &g1,
+                                          const gamma_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const gamma_dist<float_t> &g) {
+                                                   const gamma_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[gamma " << g.param() << ']';
@@ -232,10 +285,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   gamma_dist<float_t> &g) {
-    typename gamma_dist<float_t>::param_type P;
+                                                   gamma_dist<float_t, method_t> &g) {
+    typename gamma_dist<float_t, method_t>::param_type P;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[gamma ") >> P >> utility::delim(']');
@@ -39,28 +39,32 @@
 #include <trng/limits.hpp>
 #include <trng/math.hpp>
 #include <trng/utility.hpp>
+#include <trng/precision.hpp>
 
 namespace trng {
 
   template<typename result_type, typename R>
   TRNG_CUDA_ENABLE result_type generate_canonical(R &);
 
+  template<typename result_type, typename R, typename Precision>
+  TRNG_CUDA_ENABLE result_type generate_canonical(R &, Precision);
+
   namespace detail {
 
-    template<typename result_type, typename R>
+    template<typename result_type, typename R, typename Precision>
     TRNG_CUDA_ENABLE inline
         typename std::enable_if<std::is_floating_point<result_type>::value, result_type>::type
-        generate_canonical_impl(R &r, result_type) {
-      return utility::uniformoo<result_type>(r);
+        generate_canonical_impl(R &r, result_type, Precision) {
+      return utility::uniformoo<result_type>(r, Precision());
     }
 
-    template<typename result_type, typename R>
+    template<typename result_type, typename R, typename Precision>
     TRNG_CUDA_ENABLE inline
         typename std::enable_if<math::numeric_limits<result_type>::is_integer,
                                 result_type>::type
-        generate_canonical_impl(R &r, result_type) {
+        generate_canonical_impl(R &r, result_type, Precision) {
       return static_cast<result_type>(
-          math::floor(utility::uniformco<double>(r) *
+          math::floor(utility::uniformco<double>(r, Precision()) *
                       (static_cast<double>(R::max) - static_cast<double>(R::min) + 1.0)));
     }
 
@@ -68,7 +72,13 @@ namespace trng {
 
   template<typename result_type, typename R>
   TRNG_CUDA_ENABLE result_type generate_canonical(R &g) {
-    return detail::generate_canonical_impl(g, result_type());
+    return detail::generate_canonical_impl(g, result_type(), engine_precision());
+  }
+
+  // precision policy engine_precision or full_precision
+  template<typename result_type, typename R, typename Precision>
+  TRNG_CUDA_ENABLE result_type generate_canonical(R &g, Precision) {
+    return detail::generate_canonical_impl(g, result_type(), Precision());
   }
 
 }  // namespace trng
@@ -38,6 +38,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/binomial_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -54,95 +55,261 @@ namespace trng {
 
     class param_type {
     private:
+      // smallest mean of the reduced problem for which random numbers are generated by
+      // ratio of uniforms instead of sequential inversion if no table is available
+      static constexpr double mean_hrua{10};
+
       int n_{0},               // total number of balls in urn
           m_{0},               // number of "white" balls in urn
           d_{0},               // number of selected balls
           x_min{0}, x_max{0};  // minimum and maximum values of random variable
-      std::vector<double> P_;
+      // parameters of the sampling methods without table, in terms of the reduced problem of
+      // selecting min(d, n - d) balls from an urn with min(m, n - m) white balls, whose
+      // random numbers are mapped back to the original problem
+      int d_r_{0}, m_r_{0}, mode_{0};
+      double f0_{1}, a_{0}, h_{0}, b_{0}, g_{0};
 
-      void calc_probabilities() {
+      void calc_parameters() {
         x_min = std::max(0, d_ - n_ + m_);
         x_max = std::min(d_, m_);
-        P_ = std::vector<double>();
-        for (int x{x_min}; x <= x_max; ++x)
-          P_.push_back(math::exp(
-              math::ln_binomial(static_cast<double>(m_), static_cast<double>(x)) +
-              math::ln_binomial(static_cast<double>(n_ - m_), static_cast<double>(m_ - x))));
-        // build list with cumulative density function
-        for (std::vector<double>::size_type i{1}; i < P_.size(); ++i)
-          P_[i] += P_[i - 1];
-        for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
-          P_[i] /= P_.back();
+        d_r_ = std::min(d_, n_ - d_);
+        m_r_ = std::min(m_, n_ - m_);
+        const int w_r{n_ - m_r_};
+        const double mean{static_cast<double>(d_r_) * m_r_ / n_};
+        if (mean >= mean_hrua) {
+          // constants d1 = 2 sqrt(2 / e) and d2 = 3 - 2 sqrt(3 / e) of the hat function
+          const double d1{1.7155277699214135}, d2{0.8989161620588988};
+          const double p{static_cast<double>(m_r_) / n_}, q{1 - p};
+          const double var{(n_ - d_r_) * mean * q / (n_ - 1.0)};
+          const double c{math::sqrt(var + 0.5)};
+          a_ = mean + 0.5;
+          h_ = d1 * c + d2;
+          mode_ = static_cast<int>(
+              math::floor((d_r_ + 1.0) * (m_r_ + 1.0) / (static_cast<double>(n_) + 2)));
+          g_ = ln_f(mode_);
+          b_ = std::min(std::min(d_r_, m_r_) + 1.0, math::floor(a_ + 16 * c));
+        } else
+          // probability of zero
+          f0_ = math::exp(
+              math::ln_binomial(static_cast<double>(w_r), static_cast<double>(d_r_)) -
+              math::ln_binomial(static_cast<double>(n_), static_cast<double>(d_r_)));
+      }
+
+      // logarithm of the unnormalized probability of k in the reduced problem
+      double ln_f(int k) const {
+        return -math::ln_Gamma(k + 1.0) - math::ln_Gamma(m_r_ - k + 1.0) -
+               math::ln_Gamma(d_r_ - k + 1.0) - math::ln_Gamma(n_ - m_r_ - d_r_ + k + 1.0);
       }
 
     public:
       int n() const { return n_; }
       void n(int n_new) {
         n_ = n_new;
-        calc_probabilities();
+        calc_parameters();
       }
       int m() const { return m_; }
       void m(int m_new) {
         m_ = m_new;
-        calc_probabilities();
+        calc_parameters();
       }
       int d() const { return d_; }
       void d(int d_new) {
         d_ = d_new;
-        calc_probabilities();
+        calc_parameters();
       }
       param_type() = default;
-      explicit param_type(int n, int m, int d) : n_{n}, m_{m}, d_{d} { calc_probabilities(); }
+      explicit param_type(int n, int m, int d) : n_{n}, m_{m}, d_{d} { calc_parameters(); }
       friend class hypergeometric_dist;
     };
 
   private:
+    // largest support for which random numbers are generated by inversion of a table of the
+    // cumulative distribution function, for larger supports the distribution is sampled
+    // with constant memory
+    static constexpr int support_table{1024};
+
     param_type P;
+    // cumulative density function for small supports, the table is owned by the
+    // distribution and not by its parameters such that parameters are cheap to construct
+    // and to copy
+    std::vector<double> P_;
+
+    void calc_probabilities() {
+      P_ = std::vector<double>();
+      if (P.x_max - P.x_min >= support_table)
+        return;
+      const double ln_norm{
+          math::ln_binomial(static_cast<double>(P.n_), static_cast<double>(P.d_))};
+      for (int x{P.x_min}; x <= P.x_max; ++x)
+        P_.push_back(
+            math::exp(math::ln_binomial(static_cast<double>(P.m_), static_cast<double>(x)) +
+                      math::ln_binomial(static_cast<double>(P.n_ - P.m_),
+                                        static_cast<double>(P.d_ - x)) -
+                      ln_norm));
+      // build list with cumulative density function
+      for (std::vector<double>::size_type i{1}; i < P_.size(); ++i)
+        P_[i] += P_[i - 1];
+      for (std::vector<double>::size_type i{0}; i < P_.size(); ++i)
+        P_[i] /= P_.back();
+    }
 
   public:
     // constructor
-    explicit hypergeometric_dist(int n, int m, int d) : P{n, m, d} {}
-    explicit hypergeometric_dist(const param_type &P) : P{P} {}
+    explicit hypergeometric_dist(int n, int m, int d) : P{n, m, d} { calc_probabilities(); }
+    explicit hypergeometric_dist(const param_type &P) : P{P} { calc_probabilities(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (P_.empty())
+        return sample(r, P);
       return P.x_min + static_cast<int>(utility::discrete(utility::uniformoo<double>(r),
-                                                          P.P_.begin(), P.P_.end()));
+                                                          P_.begin(), P_.end()));
     }
+    // random numbers for parameters that may change from call to call, needs neither a
+    // table nor memory allocations
     template<typename R>
     int operator()(R &r, const param_type &P) {
-      hypergeometric_dist g(P);
-      return g(r);
+      return sample(r, P);
+    }
+    // one random number for each parameter in [P_first, P_last), stored in the range
+    // beginning at first, returns the end of the output range
+    template<typename R, typename InputIt, typename OutputIt>
+    OutputIt generate(R &r, InputIt P_first, InputIt P_last, OutputIt first) {
+      for (; P_first != P_last; ++P_first, ++first)
+        *first = sample(r, *P_first);
+      return first;
     }
     // property methods
     int min() const { return P.x_min; }
     int max() const { return P.x_max; }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      calc_probabilities();
+    }
     int n() const { return P.n(); }
-    void n(int n_new) { P.n(n_new); }
+    void n(int n_new) {
+      P.n(n_new);
+      calc_probabilities();
+    }
     int m() const { return P.m(); }
-    void m(int m_new) { P.m(m_new); }
+    void m(int m_new) {
+      P.m(m_new);
+      calc_probabilities();
+    }
     int d() const { return P.d(); }
-    void d(int d_new) { P.d(d_new); }
+    void d(int d_new) {
+      P.d(d_new);
+      calc_probabilities();
+    }
     // probability density function
     double pdf(int x) const {
       if (x < P.x_min or x > P.x_max)
         return 0.0;
+      if (P_.empty()) {
+        // product of binomial probabilities by Loader, avoids the cancellation of the
+        // logarithms of the binomial coefficients
+        const double p{static_cast<double>(P.d()) / P.n()};
+        return math::exp(detail::ln_binomial_pdf(x, P.m(), p) +
+                         detail::ln_binomial_pdf(P.d() - x, P.n() - P.m(), p) -
+                         detail::ln_binomial_pdf(P.d(), P.n(), p));
+      }
       x -= P.x_min;
       if (x == 0)
-        return P.P_[0];
-      return P.P_[x] - P.P_[x - 1];
+        return P_[0];
+      return P_[x] - P_[x - 1];
     }
     // cumulative density function
     double cdf(int x) const {
       if (x < P.x_min)
         return 0.0;
-      if (x > P.x_max)
+      if (x >= P.x_max)
         return 1.0;
-      return P.P_[x - P.x_min];
+      if (P_.empty()) {
+        // sum of the probabilities of the tail that does not contain the mean, probabilities
+        // decrease in the direction of summation once beyond the mode
+        const double n{static_cast<double>(P.n())}, m{static_cast<double>(P.m())},
+            d{static_cast<double>(P.d())};
+        const double eps{math::numeric_limits<double>::epsilon()};
+        double sum{0};
+        if (x < d * m / n) {
+          double f{pdf(x)};
+          for (int i{x}; i >= P.x_min and f > eps * sum; --i) {
+            sum += f;
+            f *= i * (n - m - d + i) / ((m - i + 1) * (d - i + 1));
+          }
+          return sum;
+        }
+        double f{pdf(x + 1)};
+        for (int i{x + 1}; i <= P.x_max and f > eps * sum; ++i) {
+          sum += f;
+          f *= (m - i) * (d - i) / ((i + 1) * (n - m - d + i + 1));
+        }
+        return 1 - sum;
+      }
+      return P_[x - P.x_min];
+    }
+
+  private:
+    // sampling without table
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      int k{static_cast<double>(P.d_r_) * P.m_r_ / P.n_ >= param_type::mean_hrua
+                ? hrua(r, P)
+                : inversion(r, P)};
+      // map the reduced problem back to the original one
+      if (P.m_ > P.n_ - P.m_)
+        k = P.d_r_ - k;
+      if (P.d_r_ < P.d_)
+        k = P.m_ - k;
+      return k;
+    }
+
+    // sequential inversion starting at zero for a mean of the reduced problem below 10,
+    // takes one uniform random number and about mean + 1 steps per random number
+    template<typename R>
+    static int inversion(R &r, const param_type &P) {
+      const double m{static_cast<double>(P.m_r_)}, d{static_cast<double>(P.d_r_)},
+          w{static_cast<double>(P.n_ - P.m_r_)};
+      double u{utility::uniformoo<double>(r)}, f{P.f0_};
+      int k{0};
+      while (u > f) {
+        u -= f;
+        f *= (m - k) * (d - k) / ((k + 1) * (w - d + k + 1));
+        ++k;
+        // u exceeds the sum of all probabilities due to rounding errors, start over
+        if (f == 0 or k > P.d_r_) {
+          u = utility::uniformoo<double>(r);
+          f = P.f0_;
+          k = 0;
+        }
+      }
+      return k;
+    }
+
+    // ratio of uniforms with a table mountain hat (HRUA) by Stadlober, two uniform random
+    // numbers per trial, the squeezes avoid the evaluation of the logarithm in most cases
+    template<typename R>
+    static int hrua(R &r, const param_type &P) {
+      while (true) {
+        const double u{utility::uniformoo<double>(r)};
+        const double v{utility::uniformco<double>(r)};
+        const double x{P.a_ + P.h_ * (v - 0.5) / u};
+        if (x < 0 or x >= P.b_)
+          continue;
+        const int k{static_cast<int>(x)};
+        const double t{P.ln_f(k) - P.g_};
+        // squeeze acceptance
+        if (u * (4 - u) - 3 <= t)
+          return k;
+        // squeeze rejection
+        if (u * (u - t) >= 1)
+          continue;
+        if (2 * math::ln(u) <= t)
+          return k;
+      }
     }
   };
 
@@ -41,7 +41,12 @@
 #include <cmath>
 #include <cassert>
 #include <algorithm>
+#include <cstddef>
 #include <stdexcept>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ciso646>
 
 namespace trng {
@@ -78,6 +83,21 @@ namespace trng {
                  : ceil2(x + T(1)) - T(1);
     }
 
+    // number of set bits
+    TRNG_CUDA_ENABLE
+    inline int popcount(uint64_t x) {
+#if defined __CUDA_ARCH__
+      return __popcll(x);
+#elif defined __GNUC__
+      return __builtin_popcountll(x);
+#else
+      x = x - ((x >> 1u) & 0x5555555555555555ull);
+      x = (x & 0x3333333333333333ull) + ((x >> 2u) & 0x3333333333333333ull);
+      x = (x + (x >> 4u)) & 0x0f0f0f0f0f0f0f0full;
+      return static_cast<int>((x * 0x0101010101010101ull) >> 56u);
+#endif
+    }
+
     // ---------------------------------------------------------------
 
     template<int n>
@@ -113,6 +133,62 @@ namespace trng {
 
     // ---------------------------------------------------------------
 
+#if !(defined __CUDA_ARCH__)
+    // powers A^(2^i), i = 0, ..., 63, of the companion matrix A of the recurrence
+    // x_i = a_0 x_{i-1} + ... + a_{n-1} x_{i-n} (mod m), tables are built on first use and
+    // shared by all engines with equal parameters
+    template<int n>
+    class jump_table {
+    public:
+      static constexpr int size = 64;
+      using matrix_type = int32_t[n * n];
+
+      explicit jump_table(const int32_t (&a)[n], int32_t m) {
+        for (int j{0}; j < n; ++j)
+          for (int k{0}; k < n; ++k)
+            A[0][j * n + k] = j == 0 ? a[k] : (j == k + 1 ? 1 : 0);
+        for (int i{1}; i < size; ++i)
+          matrix_mult<n>(A[i - 1], A[i - 1], A[i], m);
+      }
+
+      const matrix_type &operator[](int i) const { return A[i]; }
+
+      static std::shared_ptr<const jump_table> get(const int32_t (&a)[n], int32_t m) {
+        using key_type = std::array<int32_t, n + 1>;
+        key_type key;
+        key[0] = m;
+        for (int j{0}; j < n; ++j)
+          key[j + 1] = a[j];
+        // most recently used table of the calling thread is looked up without locking
+        thread_local key_type last_key;
+        thread_local std::shared_ptr<const jump_table> last;
+        if (last and key == last_key)
+          return last;
+        static std::mutex mutex;
+        static std::map<key_type, std::shared_ptr<const jump_table>> tables;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          auto i(tables.find(key));
+          if (i == tables.end()) {
+            // bound memory consumption, tables in use are kept alive by their owners
+            if (tables.size() >= max_tables)
+              tables.clear();
+            i = tables.emplace(key, std::make_shared<const jump_table>(a, m)).first;
+          }
+          last = i->second;
+        }
+        last_key = key;
+        return last;
+      }
+
+    private:
+      static constexpr std::size_t max_tables = 256;
+      int32_t A[size][n * n];
+    };
+#endif
+
+    // ---------------------------------------------------------------
+
     TRNG_CUDA_ENABLE
     inline int32_t modulo_inverse(int32_t a, int32_t m) {
 #if !(defined __CUDA_ARCH__)
@@ -314,18 +390,108 @@ namespace trng {
 
     //------------------------------------------------------------------
 
-    template<int32_t m, int32_t b>
+    // block-lookahead form of the recurrence x_i = a_0 x_{i-1} + ... + a_{n-1} x_{i-n}
+    // (mod m), row j of c holds the coefficients that give x_{i+j} in terms of
+    // x_{i-1}, ..., x_{i-n}
+    template<int n, int k>
+    TRNG_CUDA_ENABLE void block_matrix(const int32_t (&a)[n], int32_t (&c)[k * n], int32_t m) {
+      for (int j{0}; j < k; ++j)
+        for (int l{0}; l < n; ++l) {
+          int64_t t{j + l < n ? a[j + l] : 0};
+          for (int i{0}; i < j and i < n; ++i) {
+            t += (static_cast<int64_t>(a[i]) * static_cast<int64_t>(c[(j - i - 1) * n + l])) %
+                 m;
+            if (t >= m)
+              t -= m;
+          }
+          c[j * n + l] = static_cast<int32_t>(t);
+        }
+    }
+
+    // next k values of the recurrence given by the block-lookahead matrix c and the
+    // state r, all values are mutually independent and reduced without branches on
+    // intermediate results
+    template<int32_t m, int n, int k>
+    TRNG_CUDA_ENABLE void block_vec_mult(const int32_t (&c)[k * n], const int32_t (&r)[n],
+                                         int32_t (&x)[k]) {
+      constexpr uint64_t m2{static_cast<uint64_t>(2u) * m * m};
+      for (int j{0}; j < k; ++j) {
+        uint64_t t{0};
+        for (int l{0}; l < n; ++l) {
+          t += static_cast<uint64_t>(c[j * n + l]) * static_cast<uint64_t>(r[l]);
+          if (n > 3)
+            t = t >= m2 ? t - m2 : t;
+        }
+        x[j] = modulo<m, (n > 3 ? 3 : n)>(t);
+      }
+    }
+
+    // advance the state r by the first j values of the block x
+    template<int n, int k>
+    TRNG_CUDA_ENABLE void block_update(int32_t (&r)[n], const int32_t (&x)[k], int j) {
+      int32_t t[n];
+      for (int l{0}; l < n; ++l)
+        t[l] = l < j ? x[j - 1 - l] : r[l - j];
+      for (int l{0}; l < n; ++l)
+        r[l] = t[l];
+    }
+
+    //------------------------------------------------------------------
+
+    // computes b^n mod m for 0 <= n < 2^31 by splitting n into chunks of the given number
+    // of bits and looking up the power of b for each chunk, smaller chunks give smaller
+    // tables at the cost of more multiplications
+    template<int32_t m, int32_t b, int bits = 16>
     class power {
-      uint32_t b_power0[0x10000], b_power1[0x08000];
-
-      int32_t pow(int32_t n) {
-        int64_t p{1}, t{b};
-        while (n > 0) {
-          if ((n & 0x1) == 0x1)
-            p = modulo<m, 1>(p * t);
-          t = modulo<m, 1>(t * t);
-          n /= 2;
+      static_assert(bits > 0 and bits <= 16, "invalid number of bits per chunk");
+
+    public:
+      static constexpr int chunks = (31 + bits - 1) / bits;
+
+    private:
+      static constexpr int32_t mask = (int32_t(1) << bits) - 1;
+      // number of entries of the table for chunk j
+      static constexpr int32_t entries(int j) {
+        return 31 - bits * j < bits ? int32_t(1) << (31 - bits * j) : int32_t(1) << bits;
+      }
+      static constexpr std::size_t total(int j) {
+        return j == 0 ? 0 : total(j - 1) + static_cast<std::size_t>(entries(j - 1));
+      }
+
+    public:
+      // size of all tables in bytes
+      static constexpr std::size_t table_size = total(chunks) * sizeof(uint32_t);
+
+    private:
+      // powers b^(i * 2^(bits * j)) for chunk j, shared by all instances with equal
+      // m, b and bits
+      struct table {
+        uint32_t b_power[total(chunks)];
+
+        table() {
+          // successive powers by incremental multiplication
+          int32_t base{b};
+          for (int j{0}; j < chunks; ++j) {
+            uint32_t *const t{b_power + total(j)};
+            t[0] = 1;
+            for (int32_t i{1}; i < entries(j); ++i)
+              t[i] = modulo<m, 1>(static_cast<uint64_t>(t[i - 1]) * base);
+            if (j + 1 < chunks)
+              base = modulo<m, 1>(static_cast<uint64_t>(t[entries(j) - 1]) * base);
+          }
         }
+      };
+
+      // built on first use, initialization of the local static is thread-safe
+      static const table &tables() {
+        static const table t;
+        return t;
+      }
+
+      static int32_t evaluate(const table &t, int32_t n) {
+        uint64_t p{t.b_power[n & mask]};
+        for (int j{1}; j < chunks; ++j)
+          p = modulo<m, 1>(p * t.b_power[total(j) + ((n >> (bits * j)) & mask)]);
         return static_cast<int32_t>(p);
       }
 
@@ -334,15 +500,14 @@ namespace trng {
       power &operator=(const power &) = delete;
       power(const power &) = delete;
 
-      power() {
-        for (int32_t i{0}; i < 0x10000; ++i)
-          b_power0[i] = pow(i);
-        for (int32_t i{0}; i < 0x08000; ++i)
-          b_power1[i] = pow(i * 0x10000);
-      }
-      int32_t operator()(int32_t n) const {
-        return modulo<m, 1>(static_cast<uint64_t>(b_power1[n >> 16]) *
-                            static_cast<uint64_t>(b_power0[n & 0xffff]));
+      power() = default;
+      int32_t operator()(int32_t n) const { return evaluate(tables(), n); }
+      // batch evaluation, the lookups for different elements are independent and may
+      // overlap or be vectorized as gathers
+      void operator()(const int32_t *n, int32_t *y, std::size_t count) const {
+        const table &t{tables()};
+        for (std::size_t i{0}; i < count; ++i)
+          y[i] = evaluate(t, n[i]);
       }
     };
 
@@ -44,6 +44,7 @@
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <cstddef>
 #include <ciso646>
 
 namespace trng {
@@ -178,6 +179,21 @@ namespace trng {
         step();
     }
 
+    // Bulk generation
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+      constexpr auto mask = int_math::mask(B);
+      unsigned int index{S.index};
+      for (; first != last; ++first) {
+        index = (index + 1) & mask;
+        S.r[index] = S.r[(index - A) & mask] + S.r[(index - B) & mask];
+        *first = S.r[index];
+      }
+      S.index = index;
+    }
+
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
+
     // Equality comparable concept
     friend bool operator==(const lagfib2plus &R1, const lagfib2plus &R2) {
       return R1.S == R2.S;
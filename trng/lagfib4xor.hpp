@@ -44,6 +44,8 @@
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <cstddef>
+#include <vector>
 #include <ciso646>
 
 namespace trng {
@@ -151,42 +153,39 @@ namespace trng {
     }
 
     void discard(unsigned long long n) {
-      const unsigned int matrix_size = D;
-      using matrix_type = matrix<GF2, matrix_size>;
-      using vector_type = vector<result_type, matrix_size>;
-      using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * D * D * D};
+      if (n < D * D / 2) {
+        for (unsigned long long i{0}; i < n; ++i)
+          step();
+      } else
+        jump(characteristic().power(n), n);
+    }
+
+    // Parallel random number generator concept
+    void jump2(unsigned int s) {
+      if (s < 64)
+        discard(1ull << s);
+      else
+        jump(characteristic().power2(s), 0);
+    }
+
+    void jump(unsigned long long s) { discard(s); }
+
+    // Bulk generation
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
       constexpr auto mask = int_math::mask(D);
-      if (n > n_pivot) {
-        const unsigned long long n_partial{n - matrix_size};
-        matrix_type M;
-        for (size_type i{0}; i < matrix_size - 1; ++i)
-          M(i, i + 1) = GF2(true);
-        M(matrix_size - 1, matrix_size - D) = GF2(true);
-        M(matrix_size - 1, matrix_size - C) = GF2(true);
-        M(matrix_size - 1, matrix_size - B) = GF2(true);
-        M(matrix_size - 1, matrix_size - A) = GF2(true);
-        M = power(M, n_partial);
-        vector_type V;
-        for (size_type i{0}; i < matrix_size; ++i)
-          V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        vector_type W;
-        for (size_type i{0}; i < matrix_size; ++i) {
-          result_type sum{};
-          for (size_type k{0}; k < matrix_size; ++k)
-            sum ^= M(i, k) * V(k);
-          W(i) = sum;
-        }
-        S.index = static_cast<unsigned int>(S.index + n_partial);
-        S.index &= mask;
-        for (size_type i{0}; i < matrix_size; ++i)
-          S.r[(S.index - i) & mask] = W(matrix_size - 1 - i);
-        n -= n_partial;
+      unsigned int index{S.index};
+      for (; first != last; ++first) {
+        index = (index + 1) & mask;
+        S.r[index] = S.r[(index - A) & mask] ^ S.r[(index - B) & mask] ^
+                     S.r[(index - C) & mask] ^ S.r[(index - D) & mask];
+        *first = S.r[index];
       }
-      for (unsigned long long i{0}; i < n; ++i)
-        step();
+      S.index = index;
     }
 
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
+
     // Equality comparable concept
     friend bool operator==(const lagfib4xor &R1, const lagfib4xor &R2) { return R1.S == R2.S; }
 
@@ -246,6 +245,39 @@ namespace trng {
           S.r[(S.index - A) & int_math::mask(D)] ^ S.r[(S.index - B) & int_math::mask(D)] ^
           S.r[(S.index - C) & int_math::mask(D)] ^ S.r[(S.index - D) & int_math::mask(D)];
     }
+
+    // characteristic polynomial of the linear recurrence
+    static GF2_polynomial_modulo<D, 3> characteristic() {
+      const std::size_t t[3]{D - A, D - B, D - C};
+      return GF2_polynomial_modulo<D, 3>(t);
+    }
+
+    // advances the state by n >= status_type::size() steps, the sequence obeys
+    // x_{i+n} = c_0 x_i + ... + c_{D-1} x_{i+D-1} with z^n = c_0 + ... + c_{D-1} z^(D-1)
+    // modulo the characteristic polynomial
+    void jump(const GF2_vector<D> &c, unsigned long long n) {
+      constexpr auto mask = int_math::mask(D);
+      // values x_i, ..., x_{i+2D-2}, where x_{i+D-1} is the most recent one
+      std::vector<result_type> x(2 * D - 1);
+      for (unsigned int j{0}; j < D; ++j)
+        x[j] = S.r[(S.index - (D - 1) + j) & mask];
+      for (unsigned int j{D}; j < 2 * D - 1; ++j)
+        x[j] = x[j - A] ^ x[j - B] ^ x[j - C] ^ x[j - D];
+      std::vector<result_type> y(D);
+      for (unsigned int k{0}; k < D; ++k)
+        if (c(k))
+          for (unsigned int j{0}; j < D; ++j)
+            y[j] ^= x[j + k];
+      S.index = static_cast<unsigned int>((S.index + n) & mask);
+      for (unsigned int j{0}; j < D; ++j)
+        S.r[(S.index - (D - 1) + j) & mask] = y[j];
+      // restore older values in the ring buffer by running the recurrence backwards
+      for (unsigned int j{D}; j < status_type::size(); ++j) {
+        const unsigned int i{(S.index - j) & mask};
+        S.r[i] = S.r[(i + D) & mask] ^ S.r[(i + D - A) & mask] ^
+                 S.r[(i + D - B) & mask] ^ S.r[(i + D - C) & mask];
+      }
+    }
   };
 
   typedef lagfib4xor<unsigned long, 471, 1586, 6988, 9689> Ziff_ul;
@@ -40,6 +40,7 @@
 #include <trng/int_types.hpp>
 #include <trng/generate_canonical.hpp>
 #include <climits>
+#include <cstddef>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
@@ -47,6 +48,9 @@
 
 namespace trng {
 
+  template<typename R>
+  class lcg64_stream_pool;
+
   class lcg64 {
   public:
     // Uniform random number generator concept
@@ -226,6 +230,12 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
+    // Bulk generation
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt, OutputIt);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
@@ -236,6 +246,9 @@ namespace trng {
     status_type S;
     static const char *const name_str;
 
+    template<typename>
+    friend class lcg64_stream_pool;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -258,6 +271,35 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64>(*this) * x);
   }
 
+  // Bulk generation
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void lcg64::generate(OutputIt first, OutputIt last) {
+    // compute four consecutive states from the same predecessor, which breaks up the
+    // serial dependency of the recurrence
+    const result_type a1{P.a}, b1{P.b};
+    const result_type a2{a1 * a1}, b2{a1 * b1 + b1};
+    const result_type a3{a2 * a1}, b3{a1 * b2 + b1};
+    const result_type a4{a2 * a2}, b4{a2 * b2 + b2};
+    result_type r{S.r};
+    while (first != last) {
+      const result_type x[4]{a1 * r + b1, a2 * r + b2, a3 * r + b3, a4 * r + b4};
+      int i{0};
+      while (i < 4 and first != last) {
+        *first = x[i];
+        ++first;
+        ++i;
+      }
+      r = x[i - 1];
+    }
+    S.r = r;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void lcg64::generate(lcg64::result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64::log2_floor(lcg64::result_type x) {
@@ -40,6 +40,7 @@
 #include <trng/int_types.hpp>
 #include <trng/generate_canonical.hpp>
 #include <climits>
+#include <cstddef>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
@@ -47,6 +48,12 @@
 
 namespace trng {
 
+  template<unsigned int L>
+  class lcg64_shift_simd;
+
+  template<typename R>
+  class lcg64_stream_pool;
+
   class lcg64_shift {
   public:
     // Uniform random number generator concept
@@ -86,6 +93,8 @@ namespace trng {
       explicit parameter_type(result_type a, result_type b) : a{a}, b{b} {};
 
       friend class lcg64_shift;
+      template<unsigned int L>
+      friend class lcg64_shift_simd;
 
       // Equality comparable concept
       friend bool operator==(const parameter_type &, const parameter_type &);
@@ -125,6 +134,8 @@ namespace trng {
       explicit status_type(result_type r) : r{r} {};
 
       friend class lcg64_shift;
+      template<unsigned int L>
+      friend class lcg64_shift_simd;
 
       // Equality comparable concept
       friend bool operator==(const status_type &, const status_type &);
@@ -226,6 +237,12 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
+    // Bulk generation
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt, OutputIt);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
@@ -236,6 +253,11 @@ namespace trng {
     status_type S;
     static const char *const name_str;
 
+    template<unsigned int L>
+    friend class lcg64_shift_simd;
+    template<typename>
+    friend class lcg64_stream_pool;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -262,6 +284,43 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64_shift>(*this) * x);
   }
 
+  // Bulk generation
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void lcg64_shift::generate(OutputIt first, OutputIt last) {
+    // compute four consecutive states from the same predecessor, which breaks up the
+    // serial dependency of the recurrence
+    const result_type a1{P.a}, b1{P.b};
+    const result_type a2{a1 * a1}, b2{a1 * b1 + b1};
+    const result_type a3{a2 * a1}, b3{a1 * b2 + b1};
+    const result_type a4{a2 * a2}, b4{a2 * b2 + b2};
+    result_type r{S.r};
+    while (first != last) {
+      const result_type x[4]{a1 * r + b1, a2 * r + b2, a3 * r + b3, a4 * r + b4};
+      result_type y[4];
+      for (int j{0}; j < 4; ++j) {
+        result_type t{x[j]};
+        t ^= (t >> 17u);
+        t ^= (t << 31u);
+        t ^= (t >> 8u);
+        y[j] = t;
+      }
+      int i{0};
+      while (i < 4 and first != last) {
+        *first = y[i];
+        ++first;
+        ++i;
+      }
+      r = x[i - 1];
+    }
+    S.r = r;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void lcg64_shift::generate(lcg64_shift::result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64_shift::log2_floor(lcg64_shift::result_type x) {
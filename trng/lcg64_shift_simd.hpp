@@ -0,0 +1,258 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_LCG64_SHIFT_SIMD_HPP)
+
+#define TRNG_LCG64_SHIFT_SIMD_HPP
+
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/lcg64_shift.hpp>
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <ostream>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <ciso646>
+
+namespace trng {
+
+  // lcg64_shift_simd yields exactly the same sequence as lcg64_shift but advances L
+  // leapfrog substreams side by side.  The lanes are independent of each other, which
+  // permits the compiler to map the lane loops onto vector registers.
+  template<unsigned int L>
+  class lcg64_shift_simd {
+    static_assert(L > 0, "number of lanes must be positive");
+
+  public:
+    // Uniform random number generator concept
+    using result_type = lcg64_shift::result_type;
+    result_type operator()() {
+      if (i == L)
+        refill();
+      return y[i++];
+    }
+
+  private:
+    static constexpr result_type min_ = 0;
+    static constexpr result_type max_ = ~result_type(0);
+
+  public:
+    static constexpr result_type min() { return min_; }
+    static constexpr result_type max() { return max_; }
+
+    // Parameter and status classes
+    using parameter_type = lcg64_shift::parameter_type;
+    using status_type = lcg64_shift::status_type;
+
+    // Random number engine concept
+    explicit lcg64_shift_simd(parameter_type P = lcg64_shift::Default) { load(lcg64_shift(P)); }
+    explicit lcg64_shift_simd(unsigned long s, parameter_type P = lcg64_shift::Default) {
+      load(lcg64_shift(s, P));
+    }
+    explicit lcg64_shift_simd(unsigned long long s, parameter_type P = lcg64_shift::Default) {
+      load(lcg64_shift(s, P));
+    }
+    template<typename gen>
+    explicit lcg64_shift_simd(gen &g, parameter_type P = lcg64_shift::Default) {
+      load(lcg64_shift(g, P));
+    }
+    // construct from a scalar engine, continues the scalar engine's sequence; the
+    // non-const overload takes precedence over seeding from a generator
+    explicit lcg64_shift_simd(const lcg64_shift &R) { load(R); }
+    explicit lcg64_shift_simd(lcg64_shift &R) { load(R); }
+
+    void seed() { (*this) = lcg64_shift_simd(); }
+    void seed(unsigned long s) {
+      lcg64_shift R{scalar()};
+      R.seed(s);
+      load(R);
+    }
+    template<typename gen>
+    void seed(gen &g) {
+      lcg64_shift R{scalar()};
+      R.seed(g);
+      load(R);
+    }
+    void seed(unsigned long long s) {
+      lcg64_shift R{scalar()};
+      R.seed(s);
+      load(R);
+    }
+
+    // Equality comparable concept
+    friend bool operator==(const lcg64_shift_simd &R1, const lcg64_shift_simd &R2) {
+      return R1.scalar() == R2.scalar();
+    }
+    friend bool operator!=(const lcg64_shift_simd &R1, const lcg64_shift_simd &R2) {
+      return not(R1 == R2);
+    }
+
+    // Streamable concept
+    template<typename char_t, typename traits_t>
+    friend std::basic_ostream<char_t, traits_t> &operator<<(
+        std::basic_ostream<char_t, traits_t> &out, const lcg64_shift_simd &R) {
+      std::ios_base::fmtflags flags(out.flags());
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out << '[' << lcg64_shift_simd::name() << ' ' << R.P << ' ' << R.status() << ']';
+      out.flags(flags);
+      return out;
+    }
+
+    template<typename char_t, typename traits_t>
+    friend std::basic_istream<char_t, traits_t> &operator>>(
+        std::basic_istream<char_t, traits_t> &in, lcg64_shift_simd &R) {
+      parameter_type P_new;
+      status_type S_new;
+      std::ios_base::fmtflags flags(in.flags());
+      in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      in >> utility::ignore_spaces();
+      in >> utility::delim('[') >> utility::delim(lcg64_shift_simd::name()) >>
+          utility::delim(' ') >> P_new >> utility::delim(' ') >> S_new >> utility::delim(']');
+      if (in)
+        R.load(P_new, S_new);
+      in.flags(flags);
+      return in;
+    }
+
+    // Parallel random number generator concept
+    void split(unsigned int s, unsigned int n) {
+      lcg64_shift R{scalar()};
+      R.split(s, n);
+      load(R);
+    }
+    void jump2(unsigned int s) {
+      lcg64_shift R{scalar()};
+      R.jump2(s);
+      load(R);
+    }
+    void jump(unsigned long long s) {
+      lcg64_shift R{scalar()};
+      R.jump(s);
+      load(R);
+    }
+    void discard(unsigned long long n) { jump(n); }
+
+    // Bulk generation
+    template<typename OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+      while (first != last) {
+        if (i == L)
+          refill();
+        unsigned int j{i};
+        for (; j < L and first != last; ++j, ++first)
+          *first = y[j];
+        i = j;
+      }
+    }
+
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
+
+    // Other useful methods
+  private:
+    static std::string init_name() {
+      std::stringstream name_str;
+      name_str << "lcg64_shift_simd_" << L;
+      return name_str.str();
+    }
+
+  public:
+    static const char *name() {
+      static const std::string name_str(init_name());
+      return name_str.c_str();
+    }
+    long operator()(long x) {
+      return static_cast<long>(utility::uniformco<double, lcg64_shift_simd>(*this) * x);
+    }
+    static constexpr unsigned int lanes() { return L; }
+
+  private:
+    parameter_type P;
+    // leapfrog parameters for advancing each lane by L steps
+    result_type a_L{0}, b_L{0};
+    // state before the current block and lane states of the current block
+    result_type r0{0}, r[L]{};
+    // output buffer of the current block and position of the next output
+    result_type y[L]{};
+    unsigned int i{0};
+
+    // status of the equivalent scalar engine at the current position in the sequence
+    status_type status() const { return status_type(i > 0 ? r[i - 1] : r0); }
+
+    // equivalent scalar engine at the current position in the sequence
+    lcg64_shift scalar() const {
+      lcg64_shift R(P);
+      R.S = status();
+      return R;
+    }
+
+    void load(const lcg64_shift &R) { load(R.P, R.S); }
+
+    void load(const parameter_type &P_new, const status_type &S_new) {
+      P = P_new;
+      a_L = lcg64_shift::pow(P.a, L);
+      b_L = lcg64_shift::f(L, P.a) * P.b;
+      r0 = S_new.r;
+      result_type x{r0};
+      for (unsigned int j{0}; j < L; ++j) {
+        x = P.a * x + P.b;
+        r[j] = x;
+      }
+      transform();
+      i = 0;
+    }
+
+    void refill() {
+      r0 = r[L - 1];
+      for (unsigned int j{0}; j < L; ++j)
+        r[j] = a_L * r[j] + b_L;
+      transform();
+      i = 0;
+    }
+
+    void transform() {
+      for (unsigned int j{0}; j < L; ++j) {
+        result_type t{r[j]};
+        t ^= (t >> 17u);
+        t ^= (t << 31u);
+        t ^= (t >> 8u);
+        y[j] = t;
+      }
+    }
+  };
+
+}  // namespace trng
+
+#endif
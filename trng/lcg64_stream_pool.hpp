@@ -0,0 +1,121 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_LCG64_STREAM_POOL_HPP)
+
+#define TRNG_LCG64_STREAM_POOL_HPP
+
+#include <trng/utility.hpp>
+#include <trng/lcg64.hpp>
+#include <trng/lcg64_shift.hpp>
+#include <trng/lcg64_count_shift.hpp>
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+#include <ciso646>
+
+namespace trng {
+
+  // all streams of a leapfrog split of an engine of the lcg64 family, the streams share
+  // their parameters, which are stored only once, plus one status per stream
+  template<typename R>
+  class lcg64_stream_pool {
+  public:
+    using engine_type = R;
+    using result_type = typename R::result_type;
+    using parameter_type = typename R::parameter_type;
+    using status_type = typename R::status_type;
+
+    // stream j of the pool equals a copy of r after calling split(s, j)
+    explicit lcg64_stream_pool(const R &r, unsigned int s) : P{r.P}, S(s) {
+      if (s < 1)
+        utility::throw_this(
+            std::invalid_argument("invalid argument for trng::lcg64_stream_pool"));
+      R t(r);
+      t.split(s, 0);
+      // stream j starts j steps of the original sequence after stream 0
+      R u(r);
+      u.S = t.S;
+      for (auto &S_j : S) {
+        S_j = u.S;
+        u.step();
+      }
+      P = t.P;
+    }
+
+    std::size_t size() const { return S.size(); }
+
+    // next number of stream j
+    result_type operator()(std::size_t j) {
+      R t(make(S[j]));
+      const result_type x{t()};
+      S[j] = t.S;
+      return x;
+    }
+
+    // numbers of stream j
+    template<typename OutputIt>
+    void generate(std::size_t j, OutputIt first, OutputIt last) {
+      R t(make(S[j]));
+      t.generate(first, last);
+      S[j] = t.S;
+    }
+
+    // next number of each stream, size() numbers in total
+    template<typename OutputIt>
+    void generate(OutputIt first) {
+      R t(P);
+      for (auto &S_j : S) {
+        t.S = S_j;
+        *first = t();
+        ++first;
+        S_j = t.S;
+      }
+    }
+
+    // copy of stream j as an independent engine
+    R engine(std::size_t j) const { return make(S[j]); }
+
+  private:
+    parameter_type P;
+    std::vector<status_type> S;
+
+    R make(const status_type &S_j) const {
+      R t(P);
+      t.S = S_j;
+      return t;
+    }
+  };
+
+}  // namespace trng
+
+#endif
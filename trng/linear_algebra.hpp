@@ -36,9 +36,11 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 #include <ciso646>
 #include <iostream>
 #include <type_traits>
+#include <stdexcept>
 #include <trng/utility.hpp>
 #include <trng/int_math.hpp>
 
@@ -282,6 +284,398 @@ namespace trng {
   }
 
 
+  // vectors over GF(2), elements are packed into 64-bit words
+  template<std::size_t n>
+  class GF2_vector {
+  public:
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    static constexpr size_type words() { return (n + 63) / 64; }
+
+  private:
+    std::vector<word_type> data;
+
+  public:
+    GF2_vector() : data(words()) {}
+
+    template<typename F>
+    explicit GF2_vector(F f) : data(words()) {
+      for (size_type i{0}; i < n; ++i)
+        set(i, f(i));
+    }
+
+    bool operator()(size_type i) const { return ((data[i / 64] >> (i % 64)) & 1u) == 1u; }
+    void set(size_type i, bool v) {
+      const word_type mask{word_type(1) << (i % 64)};
+      data[i / 64] = v ? (data[i / 64] | mask) : (data[i / 64] & ~mask);
+    }
+    word_type &word(size_type i) { return data[i]; }
+    const word_type &word(size_type i) const { return data[i]; }
+    constexpr size_type size() const { return n; }
+    bool operator==(const GF2_vector &other) const { return data == other.data; }
+    bool operator!=(const GF2_vector &other) const { return data != other.data; }
+  };
+
+
+  // square matrices over GF(2), rows are packed into 64-bit words
+  template<std::size_t n>
+  class GF2_matrix {
+  public:
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    static constexpr size_type words() { return GF2_vector<n>::words(); }
+
+  private:
+    std::vector<word_type> data;
+
+  public:
+    GF2_matrix() : data(n * words()) {}
+
+    template<typename F>
+    explicit GF2_matrix(F f) : data(n * words()) {
+      for (size_type i{0}; i < n; ++i)
+        for (size_type j{0}; j < n; ++j)
+          set(i, j, f(i, j));
+    }
+
+    bool operator()(size_type i, size_type j) const {
+      return ((data[i * words() + j / 64] >> (j % 64)) & 1u) == 1u;
+    }
+    void set(size_type i, size_type j, bool v) {
+      const word_type mask{word_type(1) << (j % 64)};
+      word_type &w{data[i * words() + j / 64]};
+      w = v ? (w | mask) : (w & ~mask);
+    }
+    word_type *row(size_type i) { return data.data() + i * words(); }
+    const word_type *row(size_type i) const { return data.data() + i * words(); }
+    constexpr size_type size() const { return n; }
+    bool operator==(const GF2_matrix &other) const { return data == other.data; }
+    bool operator!=(const GF2_matrix &other) const { return data != other.data; }
+  };
+
+
+  template<std::size_t n>
+  GF2_vector<n> operator*(const GF2_matrix<n> &a, const GF2_vector<n> &b) {
+    using size_type = typename GF2_matrix<n>::size_type;
+    using word_type = typename GF2_matrix<n>::word_type;
+    GF2_vector<n> res;
+    for (size_type i{0}; i < n; ++i) {
+      const word_type *a_i{a.row(i)};
+      int sum{0};
+      for (size_type k{0}; k < GF2_matrix<n>::words(); ++k)
+        sum += int_math::popcount(a_i[k] & b.word(k));
+      res.set(i, (sum & 1) == 1);
+    }
+    return res;
+  }
+
+
+  // multiplies a matrix over GF(2) by a vector of bit-sliced words
+  template<typename T, std::size_t n>
+  typename std::enable_if<std::is_integral<T>::value, vector<T, n>>::type operator*(
+      const GF2_matrix<n> &a, const vector<T, n> &b) {
+    using size_type = typename GF2_matrix<n>::size_type;
+    using word_type = typename GF2_matrix<n>::word_type;
+    vector<T, n> res;
+    for (size_type i{0}; i < n; ++i) {
+      const word_type *a_i{a.row(i)};
+      T sum{0};
+      for (size_type k{0}; k < n; ++k)
+        sum ^= b(k) & (T(0) - static_cast<T>((a_i[k / 64] >> (k % 64)) & 1u));
+      res(i) = sum;
+    }
+    return res;
+  }
+
+
+  // method of four Russians, rows of the right factor are combined in groups of eight bits
+  // by looking up all their 256 linear combinations
+  template<std::size_t n>
+  GF2_matrix<n> operator*(const GF2_matrix<n> &a, const GF2_matrix<n> &b) {
+    using size_type = typename GF2_matrix<n>::size_type;
+    using word_type = typename GF2_matrix<n>::word_type;
+    const size_type words{GF2_matrix<n>::words()};
+    GF2_matrix<n> res;
+    std::vector<word_type> table(256 * words);
+    for (size_type k0{0}; k0 < n; k0 += 8) {
+      const unsigned int combinations{1u << utility::min(n - k0, size_type(8))};
+      for (unsigned int t{1}; t < combinations; ++t) {
+        unsigned int bit{0};
+        while (((t >> bit) & 1u) == 0)
+          ++bit;
+        const word_type *t_prev{table.data() + (t & (t - 1)) * words};
+        const word_type *b_k{b.row(k0 + bit)};
+        word_type *t_i{table.data() + t * words};
+        for (size_type l{0}; l < words; ++l)
+          t_i[l] = t_prev[l] ^ b_k[l];
+      }
+      for (size_type i{0}; i < n; ++i) {
+        const unsigned int t{
+            static_cast<unsigned int>((a.row(i)[k0 / 64] >> (k0 % 64)) & 0xffu)};
+        if (t != 0) {
+          const word_type *t_i{table.data() + t * words};
+          word_type *res_i{res.row(i)};
+          for (size_type l{0}; l < words; ++l)
+            res_i[l] ^= t_i[l];
+        }
+      }
+    }
+    return res;
+  }
+
+
+  template<std::size_t n>
+  GF2_matrix<n> power(const GF2_matrix<n> &a, unsigned long long m) {
+    using matrix_type = GF2_matrix<n>;
+    using size_type = typename matrix_type::size_type;
+
+    auto unit = [&](size_type i, size_type j) -> bool { return i == j; };
+    matrix_type res(unit);
+    matrix_type powers(a);
+    while (m > 0) {
+      if ((m & 1ull) == 1ull)
+        res = res * powers;
+      m >>= 1u;
+      if (m == 0)
+        break;
+      powers = powers * powers;
+    }
+    return res;
+  }
+
+
+  // arithmetic of polynomials over GF(2) modulo a polynomial p(z) of degree n, a polynomial
+  // of degree less than n is given by the vector of its coefficients, reduction modulo p
+  // is provided by the derived class
+  template<std::size_t n, typename derived>
+  class GF2_polynomial_arithmetic {
+    static_assert(n > 1, "degree must be larger than one");
+
+  public:
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    using polynomial_type = GF2_vector<n>;
+
+  protected:
+    // spreads the bits of a 32-bit word into the even bits of a 64-bit word
+    static word_type spread(word_type x) {
+      x &= 0xffffffffull;
+      x = (x | (x << 16u)) & 0x0000ffff0000ffffull;
+      x = (x | (x << 8u)) & 0x00ff00ff00ff00ffull;
+      x = (x | (x << 4u)) & 0x0f0f0f0f0f0f0f0full;
+      x = (x | (x << 2u)) & 0x3333333333333333ull;
+      x = (x | (x << 1u)) & 0x5555555555555555ull;
+      return x;
+    }
+
+    static bool get(const std::vector<word_type> &a, size_type i) {
+      return ((a[i / 64] >> (i % 64)) & 1u) == 1u;
+    }
+
+    static void flip(std::vector<word_type> &a, size_type i) {
+      a[i / 64] ^= word_type(1) << (i % 64);
+    }
+
+    // reduces a polynomial of degree less than or equal to d, a holds at least one word more
+    // than required for d
+    polynomial_type reduce(std::vector<word_type> &a, size_type d) const {
+      static_cast<const derived &>(*this).reduce_top(a, d);
+      polynomial_type res;
+      for (size_type i{0}; i < polynomial_type::words(); ++i)
+        res.word(i) = a[i];
+      return res;
+    }
+
+  public:
+    polynomial_type square(const polynomial_type &a) const {
+      std::vector<word_type> b(2 * polynomial_type::words() + 1);
+      for (size_type i{0}; i < polynomial_type::words(); ++i) {
+        b[2 * i] = spread(a.word(i));
+        b[2 * i + 1] = spread(a.word(i) >> 32u);
+      }
+      return reduce(b, 2 * n - 2);
+    }
+
+    polynomial_type times_z(const polynomial_type &a) const {
+      std::vector<word_type> b(polynomial_type::words() + 2);
+      for (size_type i{0}; i < polynomial_type::words(); ++i) {
+        b[i] |= a.word(i) << 1u;
+        b[i + 1] = a.word(i) >> 63u;
+      }
+      return reduce(b, n);
+    }
+
+    // z^m mod p(z), where m is given by its binary digits, the most significant first
+    template<typename F>
+    polynomial_type power(F digit, unsigned int digits) const {
+      polynomial_type res;
+      res.set(0, true);
+      unsigned int i{0};
+      while (i < digits and not digit(i))
+        ++i;
+      for (; i < digits; ++i) {
+        res = square(res);
+        if (digit(i))
+          res = times_z(res);
+      }
+      return res;
+    }
+
+    // z^m mod p(z)
+    polynomial_type power(unsigned long long m) const {
+      auto digit = [m](unsigned int i) -> bool { return ((m >> (63 - i)) & 1ull) == 1ull; };
+      return power(digit, 64);
+    }
+
+    // z^(2^s) mod p(z)
+    polynomial_type power2(unsigned int s) const {
+      polynomial_type res;
+      res.set(1, true);
+      for (unsigned int i{0}; i < s; ++i)
+        res = square(res);
+      return res;
+    }
+  };
+
+
+  // arithmetic of polynomials over GF(2) modulo the sparse polynomial
+  // p(z) = z^n + z^t_1 + ... + z^t_k + 1 with 0 < t_i < n
+  template<std::size_t n, std::size_t k>
+  class GF2_polynomial_modulo
+      : public GF2_polynomial_arithmetic<n, GF2_polynomial_modulo<n, k>> {
+    using base = GF2_polynomial_arithmetic<n, GF2_polynomial_modulo<n, k>>;
+    friend base;
+
+  public:
+    using size_type = typename base::size_type;
+    using word_type = typename base::word_type;
+    using polynomial_type = typename base::polynomial_type;
+
+  private:
+    size_type t[k];
+
+    void reduce_top(std::vector<word_type> &a, size_type d) const {
+      for (size_type e{d}; e >= n; --e)
+        if (base::get(a, e)) {
+          base::flip(a, e);
+          base::flip(a, e - n);
+          for (size_type i{0}; i < k; ++i)
+            base::flip(a, e - n + t[i]);
+        }
+    }
+
+  public:
+    explicit GF2_polynomial_modulo(const size_type (&t)[k]) {
+      for (size_type i{0}; i < k; ++i)
+        this->t[i] = t[i];
+    }
+  };
+
+
+  // arithmetic of polynomials over GF(2) modulo the dense polynomial
+  // p(z) = z^n + c_{n-1} z^(n-1) + ... + c_0
+  template<std::size_t n>
+  class GF2_dense_polynomial_modulo
+      : public GF2_polynomial_arithmetic<n, GF2_dense_polynomial_modulo<n>> {
+    using base = GF2_polynomial_arithmetic<n, GF2_dense_polynomial_modulo<n>>;
+    friend base;
+
+  public:
+    using size_type = typename base::size_type;
+    using word_type = typename base::word_type;
+    using polynomial_type = typename base::polynomial_type;
+
+  private:
+    // coefficients of p including the leading one
+    GF2_vector<n + 1> p;
+
+    void reduce_top(std::vector<word_type> &a, size_type d) const {
+      for (size_type e{d}; e >= n; --e)
+        if (base::get(a, e)) {
+          // subtract z^(e-n) p(z), which clears the coefficient of z^e
+          const size_type q{(e - n) / 64}, b{(e - n) % 64};
+          for (size_type i{0}; i < GF2_vector<n + 1>::words(); ++i) {
+            a[q + i] ^= p.word(i) << b;
+            if (b > 0)
+              a[q + i + 1] ^= p.word(i) >> (64 - b);
+          }
+        }
+    }
+
+  public:
+    explicit GF2_dense_polynomial_modulo(const polynomial_type &c) {
+      for (size_type i{0}; i < n; ++i)
+        p.set(i, c(i));
+      p.set(n, true);
+    }
+  };
+
+
+  // characteristic polynomial z^n + c_{n-1} z^(n-1) + ... + c_0 of a linear recurring
+  // sequence of bits with linear complexity n as given by the Berlekamp-Massey algorithm,
+  // the sequence must hold at least 2n bits
+  template<std::size_t n>
+  GF2_vector<n> minimal_polynomial(const std::vector<bool> &s) {
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    const size_type len{s.size()};
+    if (len < 2 * n)
+      utility::throw_this(
+          std::invalid_argument("sequence too short in trng::minimal_polynomial"));
+    // bit-reversed sequence, so that s_k, s_{k-1}, ... is stored contiguously
+    std::vector<word_type> r(len / 64 + 4);
+    for (size_type j{0}; j < len; ++j)
+      if (s[len - 1 - j])
+        r[j / 64] |= word_type(1) << (j % 64);
+    auto word = [](const std::vector<word_type> &a, size_type i) -> word_type {
+      const size_type q{i / 64}, b{i % 64};
+      return b == 0 ? a[q] : (a[q] >> b) | (a[q + 1] << (64 - b));
+    };
+    // connection polynomials 1 + c_1 z + ... + c_L z^L
+    const size_type words{GF2_vector<n + 1>::words() + 1};
+    std::vector<word_type> C(words + 1), B(words + 1);
+    C[0] = B[0] = 1;
+    size_type L{0}, m{1};
+    for (size_type k{0}; k < len; ++k) {
+      // discrepancy s_k + c_1 s_{k-1} + ... + c_L s_{k-L}
+      const size_type offset{len - 1 - k};
+      int d{0};
+      for (size_type i{0}; i <= L / 64; ++i) {
+        word_type w{C[i] & word(r, offset + 64 * i)};
+        if (i == L / 64)
+          w &= (L % 64 == 63) ? ~word_type(0) : (word_type(2) << (L % 64)) - 1;
+        d += int_math::popcount(w);
+      }
+      if ((d & 1) == 0) {
+        ++m;
+        continue;
+      }
+      const std::vector<word_type> T(C);
+      // C(z) = C(z) - z^m B(z)
+      const size_type q{m / 64}, b{m % 64};
+      for (size_type i{0}; i + q < words; ++i) {
+        C[i + q] ^= B[i] << b;
+        if (b > 0)
+          C[i + q + 1] ^= B[i] >> (64 - b);
+      }
+      if (2 * L <= k) {
+        L = k + 1 - L;
+        B = T;
+        m = 1;
+      } else
+        ++m;
+      if (L > n)
+        break;
+    }
+    if (L != n)
+      utility::throw_this(
+          std::runtime_error("unexpected linear complexity in trng::minimal_polynomial"));
+    GF2_vector<n> c;
+    for (size_type j{0}; j < n; ++j)
+      c.set(j, ((C[(n - j) / 64] >> ((n - j) % 64)) & 1u) == 1u);
+    return c;
+  }
+
 }  // namespace trng
 
 #endif
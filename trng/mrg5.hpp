@@ -43,6 +43,7 @@
 #include <ostream>
 #include <istream>
 #include <stdexcept>
+#include <cstddef>
 #include <ciso646>
 
 namespace trng {
@@ -139,6 +140,12 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
+    // Bulk generation
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt, OutputIt);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
@@ -149,6 +156,11 @@ namespace trng {
     status_type S;
     static const char *const name_str;
 
+    template<typename>
+    friend class mrg_split_streams;
+    template<typename>
+    friend class stream_array;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -184,6 +196,54 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, mrg5>(*this) * x);
   }
 
+  // Bulk generation
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void mrg5::generate(OutputIt first, OutputIt last) {
+    constexpr int block_size{16};
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])},
+        a2{static_cast<uint64_t>(P.a[2])}, a3{static_cast<uint64_t>(P.a[3])},
+        a4{static_cast<uint64_t>(P.a[4])};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]}, r4{S.r[4]};
+    // short sequences are generated step by step
+    for (int i{0}; i < 4 * block_size and first != last; ++i, ++first) {
+      uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1) +
+                 a2 * static_cast<uint64_t>(r2) + a3 * static_cast<uint64_t>(r3)};
+      if (t >= static_cast<uint64_t>(2u) * modulus * modulus)
+        t -= static_cast<uint64_t>(2u) * modulus * modulus;
+      t += a4 * static_cast<uint64_t>(r4);
+      r4 = r3;
+      r3 = r2;
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 5>(t);
+      *first = r0;
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+    S.r[4] = r4;
+    // longer sequences are generated in blocks of mutually independent linear
+    // combinations of the state, which can be evaluated in parallel
+    if (first == last)
+      return;
+    int32_t c[block_size * 5], x[block_size];
+    int_math::block_matrix<5, block_size>(P.a, c, modulus);
+    while (first != last) {
+      int_math::block_vec_mult<modulus, 5, block_size>(c, S.r, x);
+      int i{0};
+      for (; i < block_size and first != last; ++i, ++first)
+        *first = x[i];
+      int_math::block_update<5, block_size>(S.r, x, i);
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void mrg5::generate(mrg5::result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void mrg5::split(unsigned int s, unsigned int n) {
@@ -261,6 +321,14 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void mrg5::jump2(unsigned int s) {
+#if !(defined __CUDA_ARCH__)
+    if (s < int_math::jump_table<5>::size) {
+      const auto A(int_math::jump_table<5>::get(P.a, modulus));
+      const result_type r[5]{S.r[0], S.r[1], S.r[2], S.r[3], S.r[4]};
+      int_math::matrix_vec_mult<5>((*A)[s], r, S.r, modulus);
+      return;
+    }
+#endif
     result_type b[25], c[25]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -39,6 +39,9 @@
 
 namespace trng {
 
+  template<typename R>
+  class stream_array;
+
   template<typename result_type, int n, typename F>
   class mrg_parameter {
   protected:
@@ -63,6 +66,8 @@ namespace trng {
     }
 
     friend F;
+    template<typename>
+    friend class stream_array;
 
     // Equality comparable concept
     friend bool operator==(const mrg_parameter &P1, const mrg_parameter &P2) {
@@ -39,6 +39,12 @@
 
 namespace trng {
 
+  template<typename R>
+  class mrg_split_streams;
+
+  template<typename R>
+  class stream_array;
+
   template<typename result_type, int n, typename F>
   class mrg_status {
   protected:
@@ -67,6 +73,10 @@ namespace trng {
     }
 
     friend F;
+    template<typename>
+    friend class mrg_split_streams;
+    template<typename>
+    friend class stream_array;
 
     // Equality comparable concept
     friend bool operator==(const mrg_status &S1, const mrg_status &S2) {
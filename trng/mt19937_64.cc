@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "mt19937_64.hpp"
+#include <mutex>
 
 namespace trng {
 
@@ -80,6 +81,39 @@ namespace trng {
 
   bool operator!=(const mt19937_64 &R1, const mt19937_64 &R2) { return not(R1 == R2); }
 
+  // Parallel random number generator concept
+  const GF2_dense_polynomial_modulo<mt19937_64::mexp> &mt19937_64::characteristic() {
+    // the most significant bits of the words form a linear recurring sequence, whose
+    // minimal polynomial equals the characteristic polynomial of the generator as the
+    // latter is primitive
+    static const GF2_dense_polynomial_modulo<mexp> phi([]() {
+      mt19937_64 R;
+      std::vector<bool> s;
+      s.reserve(2 * mexp);
+      for (int i{0}; i < 2 * mexp; ++i) {
+        if (R.S.mti >= N)
+          R.reload();
+        s.push_back((R.S.mt[R.S.mti++] >> 63u) == 1u);
+      }
+      return minimal_polynomial<mexp>(s);
+    }());
+    return phi;
+  }
+
+  // z^(2^i) modulo the characteristic polynomial for i < 64, built on demand
+  const GF2_vector<mt19937_64::mexp> &mt19937_64::jump_polynomial(unsigned int i) {
+    static std::mutex mutex;
+    static std::vector<GF2_vector<mexp>> g;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (g.empty()) {
+      g.reserve(64);
+      g.push_back(characteristic().power2(0));
+    }
+    while (g.size() <= i)
+      g.push_back(characteristic().square(g.back()));
+    return g[i];
+  }
+
   // Other useful methods
   const char *const mt19937_64::name_str = "mt19937_64";
 
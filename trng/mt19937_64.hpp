@@ -52,7 +52,11 @@
 #include <trng/int_types.hpp>
 #include <trng/utility.hpp>
 #include <trng/generate_canonical.hpp>
+#include <trng/linear_algebra.hpp>
+#include <algorithm>
 #include <climits>
+#include <cstddef>
+#include <vector>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
@@ -79,6 +83,8 @@ namespace trng {
     static constexpr int M = 156;
     static constexpr result_type UM = 0xFFFFFFFF80000000u;  // most significant 33 bits
     static constexpr result_type LM = 0x7FFFFFFFu;          // least significant 31 bits
+    static constexpr result_type MA = 0xB5026F5AA96619E9u;  // twist matrix
+    static constexpr int mexp = 19937;  // Mersenne exponent, degree of the recurrence
 
   public:
     // Parameter and status classes
@@ -180,6 +186,15 @@ namespace trng {
 
     void discard(unsigned long long);
 
+    // Parallel random number generator concept
+    void jump2(unsigned int);
+    void jump(unsigned long long);
+
+    // Bulk generation
+    template<typename OutputIt>
+    void generate(OutputIt, OutputIt);
+    void generate(result_type *, std::size_t);
+
     // Equality comparable concept
     friend bool operator==(const mt19937_64 &, const mt19937_64 &);
     friend bool operator!=(const mt19937_64 &, const mt19937_64 &);
@@ -221,27 +236,35 @@ namespace trng {
     parameter_type P;
     status_type S;
     static const char *const name_str;
+
+    void reload();
+    static result_type twist(result_type, result_type);
+    static result_type temper(result_type);
+    void jump(const GF2_vector<mexp> &);
+    static const GF2_dense_polynomial_modulo<mexp> &characteristic();
+    static const GF2_vector<mexp> &jump_polynomial(unsigned int);
   };
 
   // Inline and template methods
 
-  inline mt19937_64::result_type mt19937_64::operator()() {
-    const result_type mag01[2]{0u, 0xB5026F5AA96619E9u};
-    if (S.mti >= mt19937_64::N) {  // generate N words at one time
-      int i{0};
-      for (; i < mt19937_64::N - mt19937_64::M; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + mt19937_64::M] ^ (x >> 1u) ^ mag01[(int)(x & 1u)];
-      }
-      for (; i < mt19937_64::N - 1; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + (mt19937_64::M - mt19937_64::N)] ^ (x >> 1u) ^ mag01[(int)(x & 1u)];
-      }
-      const result_type x{(S.mt[mt19937_64::N - 1] & UM) | (S.mt[0] & LM)};
-      S.mt[N - 1] = S.mt[mt19937_64::M - 1] ^ (x >> 1u) ^ mag01[(int)(x & 1u)];
-      S.mti = 0;
-    }
-    result_type x{S.mt[S.mti++]};
+  inline void mt19937_64::reload() {  // generate N words at one time
+    // the loops carry no dependencies shorter than N - M words and vectorize
+    for (int i{0}; i < N - M; ++i)
+      S.mt[i] = S.mt[i + M] ^ twist(S.mt[i], S.mt[i + 1]);
+    for (int i{N - M}; i < N - 1; ++i)
+      S.mt[i] = S.mt[i + (M - N)] ^ twist(S.mt[i], S.mt[i + 1]);
+    S.mt[N - 1] = S.mt[M - 1] ^ twist(S.mt[N - 1], S.mt[0]);
+    S.mti = 0;
+  }
+
+  // branch-free twist transformation of the upper bits of x and the lower bits of y
+  inline mt19937_64::result_type mt19937_64::twist(mt19937_64::result_type x,
+                                                   mt19937_64::result_type y) {
+    const result_type z{(x & UM) | (y & LM)};
+    return (z >> 1u) ^ ((result_type(0) - (z & 0x1u)) & MA);
+  }
+
+  inline mt19937_64::result_type mt19937_64::temper(mt19937_64::result_type x) {
     x ^= (x >> 29u) & 0x5555555555555555u;
     x ^= (x << 17u) & 0x71D67FFFEDA60000u;
     x ^= (x << 37u) & 0xFFF7EEE000000000u;
@@ -249,9 +272,100 @@ namespace trng {
     return x;
   }
 
-  inline void mt19937_64::discard(unsigned long long n) {
-    for (unsigned long long i{0}; i < n; ++i)
-      this->operator()();
+  // advances the state by m words, where g(z) = z^m mod characteristic polynomial, the
+  // sequence of words obeys w_{i+m} = g_0 w_i + ... + g_{mexp-1} w_{i+mexp-1}
+  inline void mt19937_64::jump(const GF2_vector<mt19937_64::mexp> &g) {
+    std::vector<result_type> w(N + mexp - 1);
+    for (int i{0}; i < N; ++i)
+      w[i] = S.mt[i];
+    for (std::size_t i{N}; i < w.size(); ++i)
+      w[i] = w[i - (N - M)] ^ twist(w[i - N], w[i - N + 1]);
+    std::vector<result_type> mt(N);
+    for (int j{0}; j < mexp; ++j)
+      if (g(j))
+        for (int i{0}; i < N; ++i)
+          mt[i] ^= w[i + j];
+    for (int i{0}; i < N; ++i)
+      S.mt[i] = mt[i];
+  }
+
+  inline mt19937_64::result_type mt19937_64::operator()() {
+    if (S.mti >= mt19937_64::N)
+      reload();
+    return temper(S.mt[S.mti++]);
+  }
+
+  template<typename OutputIt>
+  void mt19937_64::generate(OutputIt first, OutputIt last) {
+    while (first != last) {
+      if (S.mti >= mt19937_64::N)
+        reload();
+      int i{S.mti};
+      for (; i < mt19937_64::N and first != last; ++i, ++first)
+        *first = temper(S.mt[i]);
+      S.mti = i;
+    }
+  }
+
+  inline void mt19937_64::generate(mt19937_64::result_type *first, std::size_t n) {
+    // temper whole runs of words into the contiguous buffer
+    while (n > 0) {
+      if (S.mti >= N)
+        reload();
+      const std::size_t m{std::min(n, static_cast<std::size_t>(N - S.mti))};
+      const result_type *const mt{S.mt + S.mti};
+      for (std::size_t i{0}; i < m; ++i)
+        first[i] = temper(mt[i]);
+      S.mti += static_cast<int>(m);
+      first += m;
+      n -= m;
+    }
+  }
+
+  inline void mt19937_64::discard(unsigned long long n) { jump(n); }
+
+  // Parallel random number generator concept
+  inline void mt19937_64::jump2(unsigned int s) {
+    if (s < 64) {
+      jump(1ull << s);
+      return;
+    }
+    // position of the next word after the jump, 2^s steps ahead
+    int two_s{1};
+    for (unsigned int i{0}; i < s; ++i)
+      two_s = (2 * two_s) % N;
+    const int mti_new{(two_s + S.mti + N - 1) % N + 1};
+    // the state is shifted by 2^s - d words, the digits of this number are known
+    // explicitly as d is smaller than 2^16
+    const unsigned int d{static_cast<unsigned int>(N - S.mti + mti_new)};
+    auto digit = [s, d](unsigned int i) -> bool {
+      const unsigned int b{s - 1 - i};
+      return b >= 16 or (((0x10000u - d) >> b) & 1u) == 1u;
+    };
+    reload();
+    jump(characteristic().power(digit, s));
+    S.mti = mti_new;
+  }
+
+  inline void mt19937_64::jump(unsigned long long n) {
+    if (n <= static_cast<unsigned long long>(N - S.mti)) {
+      S.mti += static_cast<int>(n);
+      return;
+    }
+    // number of steps beyond the current block of words
+    n -= N - S.mti;
+    const unsigned long long blocks{(n - 1) / N};
+    reload();
+    if (blocks < 1024) {
+      for (unsigned long long i{0}; i < blocks; ++i)
+        reload();
+    } else {
+      const unsigned long long words{blocks * N};
+      for (unsigned int i{0}; i < 64; ++i)
+        if (((words >> i) & 1ull) == 1ull)
+          jump(jump_polynomial(i));
+    }
+    S.mti = static_cast<int>(n - blocks * N);
   }
 
   inline long mt19937_64::operator()(long x) {
@@ -38,6 +38,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/gamma_dist.hpp>
+#include <trng/poisson_dist.hpp>
 #include <cstddef>
 #include <ostream>
 #include <istream>
@@ -58,7 +60,10 @@ namespace trng {
     private:
       double p_{0};
       double r_{0};
-      std::vector<double> P_;
+      // scale of the gamma distributed mean of the Poisson mixture
+      double theta_{0};
+
+      void calc_parameters() { theta_ = (1 - p_) / p_; }
 
       // probability density function
       double pdf(int x) const {
@@ -79,50 +84,53 @@ namespace trng {
         return math::Beta_I(p_, r_, static_cast<double>(x + 1));
       }
 
-      void calc_probabilities() {
-        P_ = std::vector<double>();
-        int x{0};
-        double p{0.0};
-        while (p < 1.0 - 1.0 / 4096.0) {
-          p = cdf(x);
-          P_.push_back(p);
-          ++x;
-        }
-        P_.push_back(1);
-      }
-
     public:
       double p() const { return p_; }
       void p(double p_new) {
         p_ = p_new;
-        calc_probabilities();
+        calc_parameters();
       }
       double r() const { return r_; }
       void r(double r_new) {
         r_ = r_new;
-        calc_probabilities();
+        calc_parameters();
       }
       param_type() = default;
-      explicit param_type(double p, double r) : p_{p}, r_{r} { calc_probabilities(); }
+      explicit param_type(double p, double r) : p_{p}, r_{r} { calc_parameters(); }
       friend class negative_binomial_dist;
     };
 
   private:
     param_type P;
+    // cumulative density function, the table is owned by the distribution and not by its
+    // parameters such that parameters are cheap to construct and to copy
+    std::vector<double> P_;
+
+    void calc_probabilities() {
+      P_ = std::vector<double>();
+      int x{0};
+      double p{0.0};
+      while (p < 1.0 - 1.0 / 4096.0) {
+        p = cdf(x);
+        P_.push_back(p);
+        ++x;
+      }
+      P_.push_back(1);
+    }
 
   public:
     // constructor
-    explicit negative_binomial_dist(double p, double r) : P{p, r} {}
-    explicit negative_binomial_dist(const param_type &P) : P{P} {}
+    explicit negative_binomial_dist(double p, double r) : P{p, r} { calc_probabilities(); }
+    explicit negative_binomial_dist(const param_type &P) : P{P} { calc_probabilities(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
       double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
+      const std::size_t x{utility::discrete(p, P_.begin(), P_.end())};
       int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
+      if (x + 1 == P_.size()) {
         p -= cdf(x_i);
         while (p > 0) {
           ++x_i;
@@ -131,24 +139,43 @@ namespace trng {
       }
       return x_i;
     }
+    // random numbers for parameters that may change from call to call, needs neither a
+    // table nor memory allocations
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      negative_binomial_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
     int max() const { return math::numeric_limits<int>::max(); }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      calc_probabilities();
+    }
     double p() const { return P.p(); }
-    void p(double p_new) { P.p(p_new); }
+    void p(double p_new) {
+      P.p(p_new);
+      calc_probabilities();
+    }
     double r() const { return P.r(); }
-    void r(double r_new) { P.r(r_new); }
+    void r(double r_new) {
+      P.r(r_new);
+      calc_probabilities();
+    }
     // probability density function
     double pdf(int x) const { return P.pdf(x); }
     // cumulative density function
     double cdf(int x) const { return P.cdf(x); }
+
+  private:
+    // sampling without table as a Poisson random number whose mean is gamma distributed
+    // with shape r and scale (1 - p) / p
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      gamma_dist<double, marsaglia_tsang_tag> gamma(P.r(), P.theta_);
+      return poisson_dist::sample(r, poisson_dist::param_type(gamma(r)));
+    }
   };
 
   // -------------------------------------------------------------------
@@ -40,15 +40,170 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/sampling_method.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
+#include <type_traits>
+#include <cstddef>
 #include <ciso646>
 
 namespace trng {
 
+  // sampling methods of normal_dist in addition to inversion_tag
+
+  // ziggurat method by Marsaglia and Tsang, takes one uniform random number on the fast
+  // path, which is taken in about 98.8% of all cases, the resolution of the result is
+  // limited by the uniform random numbers, see trng/precision.hpp, host only
+  struct ziggurat_tag {};
+
+  namespace detail {
+
+    // layers of equal area v of the ziggurat for the unnormalized density
+    // f(x) = exp(-x^2 / 2), layer 0 consists of the rectangle [0, r] x [0, f(r)] and the
+    // tail x > r, layer i > 0 consists of the rectangle [0, x[i]] x [f(x[i]), f(x[i + 1])],
+    // a virtual right edge x[0] = v / f(r) gives layer 0 the same area as all other layers
+    template<typename float_t>
+    class normal_ziggurat {
+    public:
+      static constexpr int layers{128};
+      static constexpr double r{3.442619855899};
+      static constexpr double v{9.91256303526217e-3};
+      // right edges of the layers with x[layers] = 0
+      float_t x[layers + 1];
+      // ratios x[i + 1] / x[i], a point u * x[i] with u < k[i] lies below f
+      float_t k[layers];
+      // densities f(x[i])
+      float_t f[layers + 1];
+
+      static const normal_ziggurat &get() {
+        static const normal_ziggurat Z;
+        return Z;
+      }
+
+    private:
+      normal_ziggurat() {
+        double x_i{r}, f_i{math::exp(-0.5 * r * r)};
+        x[0] = static_cast<float_t>(v / f_i);
+        f[0] = static_cast<float_t>(f_i);
+        for (int i{1}; i < layers; ++i) {
+          x[i] = static_cast<float_t>(x_i);
+          f[i] = static_cast<float_t>(f_i);
+          if (i + 1 < layers) {
+            x_i = math::sqrt(-2 * math::log(v / x_i + f_i));
+            f_i = math::exp(-0.5 * x_i * x_i);
+          }
+        }
+        x[layers] = 0;
+        f[layers] = 1;
+        for (int i{0}; i < layers; ++i)
+          k[i] = x[i + 1] / x[i];
+      }
+    };
+
+    // inverse of the standard normal distribution by the rational approximations of
+    // algorithm AS 241 (PPND16) by Wichura with a relative accuracy of about 1e-16, the
+    // approximation for the central region |p - 1/2| <= 0.425 needs neither branches nor
+    // transcendental functions and can be evaluated in vectorized loops
+    class normal_inversion {
+    public:
+      static constexpr double q_central{0.425};
+
+      // q = p - 1/2 with |q| <= q_central
+      static double central(double q) {
+        const double r{0.180625 - q * q};
+        return q *
+               (((((((2509.0809287301226727 * r + 33430.575583588128105) * r +
+                     67265.770927008700853) *
+                        r +
+                    45921.953931549871457) *
+                       r +
+                   13731.693765509461125) *
+                      r +
+                  1971.5909503065514427) *
+                     r +
+                 133.14166789178437745) *
+                    r +
+                3.387132872796366608) /
+               (((((((5226.495278852545925 * r + 28729.085735721942674) * r +
+                     39307.89580009271061) *
+                        r +
+                    21213.794301586595867) *
+                       r +
+                   5394.1960214247511077) *
+                      r +
+                  687.1870074920579083) *
+                     r +
+                 42.313330701600911252) *
+                    r +
+                1);
+      }
+
+      // p with |p - 1/2| > q_central
+      static double tail(double p) {
+        const bool lower{p < 0.5};
+        double r{math::sqrt(-math::log(lower ? p : 1 - p))}, x;
+        if (r <= 5) {
+          r -= 1.6;
+          x = (((((((7.7454501427834140764e-4 * r + 0.0227238449892691845833) * r +
+                    0.24178072517745061177) *
+                       r +
+                   1.27045825245236838258) *
+                      r +
+                  3.64784832476320460504) *
+                     r +
+                 5.7694972214606914055) *
+                    r +
+                4.6303378461565452959) *
+                   r +
+               1.42343711074968357734) /
+              (((((((1.05075007164441684324e-9 * r + 5.475938084995344946e-4) * r +
+                    0.0151986665636164571966) *
+                       r +
+                   0.14810397642748007459) *
+                      r +
+                  0.68976733498510000455) *
+                     r +
+                 1.6763848301838038494) *
+                    r +
+                2.05319162663775882187) *
+                   r +
+               1);
+        } else {
+          r -= 5;
+          x = (((((((2.01033439929228813265e-7 * r + 2.71155556874348757815e-5) * r +
+                    0.0012426609473880784386) *
+                       r +
+                   0.026532189526576123093) *
+                      r +
+                  0.29656057182850489123) *
+                     r +
+                 1.7848265399172913358) *
+                    r +
+                5.4637849111641143699) *
+                   r +
+               6.6579046435011037772) /
+              (((((((2.04426310338993978564e-15 * r + 1.4215117583164458887e-7) * r +
+                    1.8463183175100546818e-5) *
+                       r +
+                   7.868691311456132591e-4) *
+                      r +
+                  0.0148753612908506148525) *
+                     r +
+                 0.13692988092273580531) *
+                    r +
+                0.59983220655588793769) *
+                   r +
+               1);
+        }
+        return lower ? -x : x;
+      }
+    };
+
+  }  // namespace detail
+
   // uniform random number generator class
-  template<typename float_t = double>
+  template<typename float_t = double, typename method_t = inversion_tag>
   class normal_dist {
   public:
     using result_type = float_t;
@@ -73,6 +228,17 @@ namespace trng {
 
       friend class normal_dist;
 
+      // EqualityComparable concept
+      friend TRNG_CUDA_ENABLE inline bool operator==(const param_type &P1,
+                                                     const param_type &P2) {
+        return P1.mu_ == P2.mu_ and P1.sigma_ == P2.sigma_;
+      }
+
+      friend TRNG_CUDA_ENABLE inline bool operator!=(const param_type &P1,
+                                                     const param_type &P2) {
+        return not(P1 == P2);
+      }
+
       // Streamable concept
       template<typename char_t, typename traits_t>
       friend std::basic_ostream<char_t, traits_t> &operator<<(
@@ -114,13 +280,20 @@ namespace trng {
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return icdf(utility::uniformoo<result_type>(r));
+      return sample(r, method_t());
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
       normal_dist g(P);
       return g(r);
     }
+    // fills [first, last) with random numbers, the uniform random numbers are generated and
+    // transformed in blocks, with the inversion method the normal random numbers are computed
+    // by algorithm AS 241 and differ from those of operator() in the last digits only
+    template<typename R, typename OutputIt>
+    void generate(R &r, OutputIt first, OutputIt last) {
+      generate(r, first, last, method_t());
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return -math::numeric_limits<result_type>::infinity(); }
@@ -155,42 +328,115 @@ namespace trng {
     // inverse cumulative density function
     TRNG_CUDA_ENABLE
     result_type icdf(result_type x) const { return math::inv_Phi(x) * P.sigma() + P.mu(); }
-  };
 
-  // -------------------------------------------------------------------
+  private:
+    // uniform random numbers for the ziggurat method, at least double precision
+    using uniform_t = typename std::conditional<(math::numeric_limits<float_t>::digits <
+                                                 math::numeric_limits<double>::digits),
+                                                double, float_t>::type;
 
-  // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const typename normal_dist<float_t>::param_type &p1,
-                                          const typename normal_dist<float_t>::param_type &p2) {
-    return p1.mu() == p2.mu() and p1.sigma() == p2.sigma();
-  }
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type sample(R &r, inversion_tag) {
+      return icdf(utility::uniformoo<result_type>(r));
+    }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const typename normal_dist<float_t>::param_type &p1,
-                                          const typename normal_dist<float_t>::param_type &p2) {
-    return not(p1 == p2);
-  }
+    template<typename R>
+    result_type sample(R &r, ziggurat_tag) {
+      return ziggurat(r) * P.sigma() + P.mu();
+    }
+
+    static constexpr std::size_t chunk{256};
+
+    // the central region of the inversion is evaluated for the whole block in a loop
+    // without branches, the tails, which hold about 15% of the block, are fixed up
+    // afterwards, AS 241 is accurate for types up to double only
+    template<typename R, typename OutputIt>
+    void generate(R &r, OutputIt first, OutputIt last, inversion_tag) {
+      if (math::numeric_limits<result_type>::digits > math::numeric_limits<double>::digits) {
+        for (; first != last; ++first)
+          *first = sample(r, inversion_tag());
+        return;
+      }
+      using Inv = detail::normal_inversion;
+      result_type u[chunk];
+      double x[chunk];
+      const double mu{static_cast<double>(P.mu())}, sigma{static_cast<double>(P.sigma())};
+      while (first != last) {
+        std::size_t n{0};
+        for (OutputIt i{first}; n < chunk and i != last; ++i)
+          ++n;
+        utility::uniformoo<result_type>(r, u, u + n);
+        for (std::size_t i{0}; i < n; ++i)
+          x[i] = Inv::central(static_cast<double>(u[i]) - 0.5);
+        for (std::size_t i{0}; i < n; ++i) {
+          const double p{static_cast<double>(u[i])};
+          if (math::abs(p - 0.5) > Inv::q_central)
+            x[i] = Inv::tail(p);
+        }
+        for (std::size_t i{0}; i < n; ++i, ++first)
+          *first = static_cast<result_type>(x[i] * sigma + mu);
+      }
+    }
+
+    template<typename R, typename OutputIt>
+    void generate(R &r, OutputIt first, OutputIt last, ziggurat_tag) {
+      for (; first != last; ++first)
+        *first = sample(r, ziggurat_tag());
+    }
+
+    // standard normal random number, the integer part of 256 times a uniform random number
+    // selects the sign and the layer, the fractional part the position within the layer
+    template<typename R>
+    static result_type ziggurat(R &r) {
+      using Z_t = detail::normal_ziggurat<float_t>;
+      const Z_t &Z{Z_t::get()};
+      while (true) {
+        const uniform_t t{utility::uniformco<uniform_t>(r) * 256};
+        const int b{static_cast<int>(t)};
+        const result_type u{static_cast<result_type>(t - b)};
+        const int i{b & (Z_t::layers - 1)};
+        const bool negative{b >= Z_t::layers};
+        result_type x{u * Z.x[i]};
+        if (u < Z.k[i])
+          return negative ? -x : x;
+        if (i == 0) {
+          // tail beyond r, method by Marsaglia
+          const result_type r0{static_cast<result_type>(Z_t::r)};
+          result_type a, c;
+          do {
+            a = -math::log(utility::uniformoo<result_type>(r)) / r0;
+            c = -math::log(utility::uniformoo<result_type>(r));
+          } while (c + c < a * a);
+          x = r0 + a;
+          return negative ? -x : x;
+        }
+        // wedge between the rectangle's inner part and f
+        const result_type y{Z.f[i] + utility::uniformco<result_type>(r) * (Z.f[i + 1] - Z.f[i])};
+        if (y < math::exp(x * x / -2))
+          return negative ? -x : x;
+      }
+    }
+  };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator==(const normal_dist<float_t> &g1,
-                                          const normal_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator==(const normal_dist<float_t, method_t> &g1,
+                                          const normal_dist<float_t, method_t> &g2) {
     return g1.param() == g2.param();
   }
 
-  template<typename float_t>
-  TRNG_CUDA_ENABLE inline bool operator!=(const normal_dist<float_t> &g1,
-                                          const normal_dist<float_t> &g2) {
+  template<typename float_t, typename method_t>
+  TRNG_CUDA_ENABLE inline bool operator!=(const normal_dist<float_t, method_t> &g1,
+                                          const normal_dist<float_t, method_t> &g2) {
     return g1.param() != g2.param();
   }
 
   // Streamable concept
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_ostream<char_t, traits_t> &operator<<(std::basic_ostream<char_t, traits_t> &out,
-                                                   const normal_dist<float_t> &g) {
+                                                   const normal_dist<float_t, method_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     out << "[normal " << g.param() << ']';
@@ -198,10 +444,10 @@ namespace trng {
     return out;
   }
 
-  template<typename char_t, typename traits_t, typename float_t>
+  template<typename char_t, typename traits_t, typename float_t, typename method_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
-                                                   normal_dist<float_t> &g) {
-    typename normal_dist<float_t>::param_type p;
+                                                   normal_dist<float_t, method_t> &g) {
+    typename normal_dist<float_t, method_t>::param_type p;
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
     in >> utility::ignore_spaces() >> utility::delim("[normal ") >> p >> utility::delim(']');
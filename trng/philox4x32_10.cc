@@ -0,0 +1,98 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "philox4x32_10.hpp"
+
+namespace trng {
+
+  // Uniform random number generator concept
+
+  // Parameter and status classes
+
+  // Equality comparable concept
+  bool operator==(const philox4x32_10::parameter_type &P1,
+                  const philox4x32_10::parameter_type &P2) {
+    return P1.s == P2.s;
+  }
+
+  bool operator!=(const philox4x32_10::parameter_type &P1,
+                  const philox4x32_10::parameter_type &P2) {
+    return not(P1 == P2);
+  }
+
+  // Equality comparable concept
+  bool operator==(const philox4x32_10::status_type &S1, const philox4x32_10::status_type &S2) {
+    return S1.k == S2.k and S1.i == S2.i;
+  }
+
+  bool operator!=(const philox4x32_10::status_type &S1, const philox4x32_10::status_type &S2) {
+    return not(S1 == S2);
+  }
+
+  const philox4x32_10::parameter_type philox4x32_10::Default = parameter_type(1u);
+
+  // Random number engine concept
+  philox4x32_10::philox4x32_10(philox4x32_10::parameter_type P) : P{P} {}
+
+  philox4x32_10::philox4x32_10(unsigned long s, philox4x32_10::parameter_type P) : P{P} {
+    seed(s);
+  }
+
+  philox4x32_10::philox4x32_10(unsigned long long s, philox4x32_10::parameter_type P) : P{P} {
+    seed(s);
+  }
+
+  void philox4x32_10::seed() { (*this) = philox4x32_10(); }
+
+  void philox4x32_10::seed(unsigned long s) { seed(static_cast<unsigned long long>(s)); }
+
+  void philox4x32_10::seed(unsigned long long s) {
+    S.k = static_cast<uint64_t>(s);
+    S.i = 0;
+    b = invalid;
+  }
+
+  // Equality comparable concept
+  bool operator==(const philox4x32_10 &R1, const philox4x32_10 &R2) {
+    return R1.P == R2.P and R1.S == R2.S;
+  }
+
+  bool operator!=(const philox4x32_10 &R1, const philox4x32_10 &R2) { return not(R1 == R2); }
+
+  // Parallel random number generator concept
+
+  // Other useful methods
+  const char *const philox4x32_10::name_str = "philox4x32_10";
+
+  const char *philox4x32_10::name() { return name_str; }
+
+}  // namespace trng
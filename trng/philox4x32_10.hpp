@@ -0,0 +1,401 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_PHILOX4X32_10_HPP)
+
+#define TRNG_PHILOX4X32_10_HPP
+
+#include <trng/cuda.hpp>
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/generate_canonical.hpp>
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <ostream>
+#include <istream>
+#include <ciso646>
+
+namespace trng {
+
+  // counter-based Philox4x32-10 generator of Salmon, Moraes, Dror and Shaw, word i of the
+  // sequence for key k is word i mod 4 of the bijection of the 128-bit counter i/4 under k
+  class philox4x32_10 {
+  public:
+    // Uniform random number generator concept
+    using result_type = uint32_t;
+    TRNG_CUDA_ENABLE
+    result_type operator()();
+
+  private:
+    static constexpr result_type min_ = 0;
+    static constexpr result_type max_ = ~result_type(0);
+
+  public:
+    static constexpr result_type min() { return min_; }
+    static constexpr result_type max() { return max_; }
+
+    // Parameter and status classes
+    class parameter_type {
+      // distance between consecutive words of a (split) stream
+      uint64_t s{1};
+
+    public:
+      parameter_type() = default;
+      explicit parameter_type(uint64_t s) : s{s} {};
+
+      friend class philox4x32_10;
+
+      // Equality comparable concept
+      friend bool operator==(const parameter_type &, const parameter_type &);
+      friend bool operator!=(const parameter_type &, const parameter_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const parameter_type &P) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << P.s << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, parameter_type &P) {
+        parameter_type P_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> P_new.s >> utility::delim(')');
+        if (in)
+          P = P_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    class status_type {
+      // key and index of the next word
+      uint64_t k{0}, i{0};
+
+    public:
+      status_type() = default;
+      explicit status_type(uint64_t k, uint64_t i) : k{k}, i{i} {};
+
+      friend class philox4x32_10;
+
+      // Equality comparable concept
+      friend bool operator==(const status_type &, const status_type &);
+      friend bool operator!=(const status_type &, const status_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const status_type &S) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << S.k << ' ' << S.i << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, status_type &S) {
+        status_type S_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> S_new.k >> utility::delim(' ') >> S_new.i >>
+            utility::delim(')');
+        if (in)
+          S = S_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    static const parameter_type Default;
+
+    // Random number engine concept
+    explicit philox4x32_10(parameter_type = Default);
+    explicit philox4x32_10(unsigned long, parameter_type = Default);
+    explicit philox4x32_10(unsigned long long, parameter_type = Default);
+
+    template<typename gen>
+    explicit philox4x32_10(gen &g, parameter_type P = Default) : P{P} {
+      seed(g);
+    }
+
+    void seed();
+    void seed(unsigned long);
+    template<typename gen>
+    void seed(gen &g) {
+      uint64_t k{0};
+      for (int i{0}; i < 2; ++i) {
+        k <<= 32u;
+        k += g();
+      }
+      S.k = k;
+      S.i = 0;
+      b = invalid;
+    }
+    void seed(unsigned long long);
+
+    // Equality comparable concept
+    friend bool operator==(const philox4x32_10 &, const philox4x32_10 &);
+    friend bool operator!=(const philox4x32_10 &, const philox4x32_10 &);
+
+    // Streamable concept
+    template<typename char_t, typename traits_t>
+    friend std::basic_ostream<char_t, traits_t> &operator<<(
+        std::basic_ostream<char_t, traits_t> &out, const philox4x32_10 &R) {
+      std::ios_base::fmtflags flags(out.flags());
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out << '[' << philox4x32_10::name() << ' ' << R.P << ' ' << R.S << ']';
+      out.flags(flags);
+      return out;
+    }
+
+    template<typename char_t, typename traits_t>
+    friend std::basic_istream<char_t, traits_t> &operator>>(
+        std::basic_istream<char_t, traits_t> &in, philox4x32_10 &R) {
+      philox4x32_10::parameter_type P_new;
+      philox4x32_10::status_type S_new;
+      std::ios_base::fmtflags flags(in.flags());
+      in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      in >> utility::ignore_spaces();
+      in >> utility::delim('[') >> utility::delim(philox4x32_10::name()) >>
+          utility::delim(' ') >> P_new >> utility::delim(' ') >> S_new >> utility::delim(']');
+      if (in) {
+        R.P = P_new;
+        R.S = S_new;
+        R.b = invalid;
+      }
+      in.flags(flags);
+      return in;
+    }
+
+    // Parallel random number generator concept
+    TRNG_CUDA_ENABLE
+    void split(unsigned int, unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump2(unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump(unsigned long long);
+    TRNG_CUDA_ENABLE
+    void discard(unsigned long long);
+
+    // Bulk generation
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt, OutputIt);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+
+    // Other useful methods
+    static const char *name();
+    TRNG_CUDA_ENABLE
+    long operator()(long);
+    // word i of the sequence for key k, independent of any engine state
+    TRNG_CUDA_ENABLE
+    static result_type at(unsigned long long k, unsigned long long i);
+
+  private:
+    static constexpr int rounds = 10;
+    static constexpr result_type M0 = 0xD2511F53u;  // round multipliers
+    static constexpr result_type M1 = 0xCD9E8D57u;
+    static constexpr result_type W0 = 0x9E3779B9u;  // Weyl sequence key increments
+    static constexpr result_type W1 = 0xBB67AE85u;
+    // marks the block buffer as not holding any block, counters are below 2^62
+    static constexpr uint64_t invalid = ~uint64_t(0);
+    // number of blocks that are computed side by side in bulk generation
+    static constexpr int lanes = 16;
+
+    parameter_type P;
+    status_type S;
+    // block of four words of the counter b
+    uint64_t b{invalid};
+    result_type y[4]{};
+    static const char *const name_str;
+
+    template<int L>
+    TRNG_CUDA_ENABLE static void bijection(uint64_t, result_type (&)[4][L]);
+    TRNG_CUDA_ENABLE
+    void fill(uint64_t);
+  };
+
+  // Inline and template methods
+
+  // applies the Philox rounds to L counters at a time, x[j][l] is word j of lane l, the
+  // lanes are independent and the inner loop vectorizes
+  template<int L>
+  TRNG_CUDA_ENABLE inline void philox4x32_10::bijection(uint64_t k, result_type (&x)[4][L]) {
+    result_type k0{static_cast<result_type>(k)}, k1{static_cast<result_type>(k >> 32u)};
+    for (int r{0}; r < rounds; ++r) {
+      for (int l{0}; l < L; ++l) {
+        const uint64_t p0{static_cast<uint64_t>(M0) * x[0][l]};
+        const uint64_t p1{static_cast<uint64_t>(M1) * x[2][l]};
+        const result_type y0{static_cast<result_type>(p1 >> 32u) ^ x[1][l] ^ k0};
+        const result_type y2{static_cast<result_type>(p0 >> 32u) ^ x[3][l] ^ k1};
+        x[0][l] = y0;
+        x[1][l] = static_cast<result_type>(p1);
+        x[2][l] = y2;
+        x[3][l] = static_cast<result_type>(p0);
+      }
+      k0 += W0;
+      k1 += W1;
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::fill(uint64_t c) {
+    result_type x[4][1]{{static_cast<result_type>(c)}, {static_cast<result_type>(c >> 32u)},
+                        {0}, {0}};
+    bijection(S.k, x);
+    for (int j{0}; j < 4; ++j)
+      y[j] = x[j][0];
+    b = c;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline philox4x32_10::result_type philox4x32_10::operator()() {
+    if ((S.i >> 2u) != b)
+      fill(S.i >> 2u);
+    const result_type x{y[S.i & 3u]};
+    S.i += P.s;
+    return x;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline long philox4x32_10::operator()(long x) {
+    return static_cast<long>(utility::uniformco<double, philox4x32_10>(*this) * x);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline philox4x32_10::result_type philox4x32_10::at(unsigned long long k,
+                                                      unsigned long long i) {
+    const uint64_t c{static_cast<uint64_t>(i) >> 2u};
+    result_type x[4][1]{{static_cast<result_type>(c)}, {static_cast<result_type>(c >> 32u)},
+                        {0}, {0}};
+    bijection(static_cast<uint64_t>(k), x);
+    return x[i & 3u][0];
+  }
+
+  // Bulk generation
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void philox4x32_10::generate(OutputIt first, OutputIt last) {
+    // words of a split stream are not adjacent, nothing to gain from batching
+    if (P.s != 1) {
+      for (; first != last; ++first)
+        *first = (*this)();
+      return;
+    }
+    // complete the current block
+    for (; first != last and (S.i & 3u) != 0; ++first)
+      *first = (*this)();
+    // whole batches of blocks
+    while (first != last) {
+      const uint64_t c{S.i >> 2u};
+      result_type x[4][lanes];
+      for (int l{0}; l < lanes; ++l) {
+        x[0][l] = static_cast<result_type>(c + l);
+        x[1][l] = static_cast<result_type>((c + l) >> 32u);
+        x[2][l] = 0;
+        x[3][l] = 0;
+      }
+      bijection(S.k, x);
+      for (int l{0}; l < lanes and first != last; ++l)
+        for (int j{0}; j < 4 and first != last; ++j, ++first) {
+          *first = x[j][l];
+          ++S.i;
+        }
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::generate(philox4x32_10::result_type *first, std::size_t n) {
+    if (P.s != 1) {
+      generate(first, first + n);
+      return;
+    }
+    // complete the current block
+    for (; n > 0 and (S.i & 3u) != 0; ++first, --n)
+      *first = (*this)();
+    // whole batches of blocks are written directly into the buffer
+    for (; n >= 4 * lanes; first += 4 * lanes, n -= 4 * lanes) {
+      const uint64_t c{S.i >> 2u};
+      result_type x[4][lanes];
+      for (int l{0}; l < lanes; ++l) {
+        x[0][l] = static_cast<result_type>(c + l);
+        x[1][l] = static_cast<result_type>((c + l) >> 32u);
+        x[2][l] = 0;
+        x[3][l] = 0;
+      }
+      bijection(S.k, x);
+      for (int l{0}; l < lanes; ++l)
+        for (int j{0}; j < 4; ++j)
+          first[4 * l + j] = x[j][l];
+      S.i += 4 * lanes;
+    }
+    generate(first, first + n);
+  }
+
+  // Parallel random number generator concept
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::split(unsigned int s, unsigned int n) {
+#if !(defined __CUDA_ARCH__)
+    if (s < 1 or n >= s)
+      utility::throw_this(
+          std::invalid_argument("invalid argument for trng::philox4x32_10::split"));
+#endif
+    S.i += n * P.s;
+    P.s *= s;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::jump2(unsigned int s) {
+    if (s < 64)
+      S.i += P.s << s;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::jump(unsigned long long s) { S.i += s * P.s; }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::discard(unsigned long long n) { jump(n); }
+
+}  // namespace trng
+
+#endif
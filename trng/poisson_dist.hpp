@@ -54,46 +54,75 @@ namespace trng {
 
     class param_type {
     private:
+      // smallest mean for which random numbers are generated by transformed rejection
+      // instead of sequential inversion if no table is available
+      static constexpr double mu_ptrs{10};
+
       double mu_{0};
-      std::vector<double> P_;
-
-      void calc_probabilities() {
-        P_ = std::vector<double>();
-        int x = 0;
-        while (x < 7 or x < 2 * mu_) {
-          P_.push_back(math::GammaQ(x + 1.0, mu_));
-          ++x;
+      // exp(-mu) and parameters of the transformed rejection method
+      double exp_mu_{1}, ln_mu_{0}, a_{0}, b_{0}, ln_inv_alpha_{0}, v_r_{0};
+
+      void calc_parameters() {
+        exp_mu_ = math::exp(-mu_);
+        if (mu_ >= mu_ptrs) {
+          const double sqrt_mu{math::sqrt(mu_)};
+          ln_mu_ = math::ln(mu_);
+          b_ = 0.931 + 2.53 * sqrt_mu;
+          a_ = -0.059 + 0.02483 * b_;
+          ln_inv_alpha_ = math::ln(1.1239 + 1.1328 / (b_ - 3.4));
+          v_r_ = 0.9277 - 3.6224 / (b_ - 2);
         }
-        P_.push_back(1);
       }
 
     public:
       double mu() const { return mu_; }
       void mu(double mu_new) {
         mu_ = mu_new;
-        calc_probabilities();
+        calc_parameters();
       }
       param_type() = default;
-      explicit param_type(double mu) : mu_{mu} { calc_probabilities(); }
+      explicit param_type(double mu) : mu_{mu} { calc_parameters(); }
       friend class poisson_dist;
     };
 
   private:
+    // largest mean for which random numbers are generated by inversion by table lookup,
+    // the table's setup costs O(mu) evaluations of GammaQ, below this limit lookups are
+    // about twice as fast as rejection
+    static constexpr double mu_table{64};
+
     param_type P;
+    // cumulative density function for small mu, the table is owned by the distribution and
+    // not by its parameters such that parameters are cheap to construct and to copy
+    std::vector<double> P_;
+
+    void calc_probabilities() {
+      P_ = std::vector<double>();
+      if (P.mu() >= mu_table)
+        return;
+      int x = 0;
+      while (x < 7 or x < 2 * P.mu()) {
+        P_.push_back(math::GammaQ(x + 1.0, P.mu()));
+        ++x;
+      }
+      P_.push_back(1);
+    }
 
   public:
     // constructor
-    explicit poisson_dist(double mu) : P{mu} {}
-    explicit poisson_dist(const param_type &P) : P{P} {}
+    explicit poisson_dist(double mu) : P{mu} { calc_probabilities(); }
+    explicit poisson_dist(const param_type &P) : P{P} { calc_probabilities(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (P_.empty())
+        return sample(r, P);
       double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
+      const std::size_t x{utility::discrete(p, P_.begin(), P_.end())};
       int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
+      if (x + 1 == P_.size()) {
         p -= cdf(x_i);
         while (p > 0) {
           ++x_i;
@@ -102,33 +131,93 @@ namespace trng {
       }
       return x_i;
     }
+    // random numbers for parameters that may change from call to call, needs neither a
+    // table nor memory allocations
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      poisson_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 0; }
     int max() const { return math::numeric_limits<int>::max(); }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      calc_probabilities();
+    }
     double mu() const { return P.mu(); }
-    void mu(double mu_new) { P.mu(mu_new); }
+    void mu(double mu_new) {
+      P.mu(mu_new);
+      calc_probabilities();
+    }
     // probability density function
     double pdf(int x) const {
       return x < 0 ? 0.0 : math::exp(-P.mu() - math::ln_Gamma(x + 1.0) + x * math::ln(P.mu()));
     }
     // cumulative density function
     double cdf(int x) const { return x < 0 ? 0.0 : math::GammaQ(x + 1.0, P.mu()); }
+
+  private:
+    // distributions that are derived from Poisson random numbers sample without table, too
+    friend class negative_binomial_dist;
+    friend class zero_truncated_poisson_dist;
+
+    // sampling without table
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      return P.mu() >= param_type::mu_ptrs ? ptrs(r, P) : inversion(r, P);
+    }
+
+    // sequential inversion starting at zero for mu < 10, takes one uniform random number and
+    // about mu + 1 steps per random number
+    template<typename R>
+    static int inversion(R &r, const param_type &P) {
+      double u{utility::uniformoo<double>(r)}, f{P.exp_mu_};
+      int x{0};
+      while (u > f) {
+        u -= f;
+        ++x;
+        f *= P.mu() / x;
+        // u exceeds the sum of all probabilities due to rounding errors, start over
+        if (f == 0) {
+          u = utility::uniformoo<double>(r);
+          f = P.exp_mu_;
+          x = 0;
+        }
+      }
+      return x;
+    }
+
+    // transformed rejection method with squeeze (PTRS) by Hoermann, valid for mu >= 10, two
+    // uniform random numbers per trial, about 1.15 trials per random number, the fast
+    // acceptance test avoids transcendental functions in most cases
+    template<typename R>
+    static int ptrs(R &r, const param_type &P) {
+      while (true) {
+        const double u{utility::uniformco<double>(r) - 0.5};
+        const double v{utility::uniformoo<double>(r)};
+        const double us{0.5 - math::abs(u)};
+        const double k{math::floor((2 * P.a_ / us + P.b_) * u + P.mu() + 0.43)};
+        if (us >= 0.07 and v <= P.v_r_)
+          return static_cast<int>(k);
+        if (k < 0 or (us < 0.013 and v > us))
+          continue;
+        if (math::ln(v) + P.ln_inv_alpha_ - math::ln(P.a_ / (us * us) + P.b_) <=
+            -P.mu() + k * P.ln_mu_ - math::ln_Gamma(k + 1))
+          return static_cast<int>(k);
+      }
+    }
   };
 
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  bool operator==(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
+  inline bool operator==(const poisson_dist::param_type &P1,
+                         const poisson_dist::param_type &P2) {
     return P1.mu() == P2.mu();
   }
-  bool operator!=(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
+  inline bool operator!=(const poisson_dist::param_type &P1,
+                         const poisson_dist::param_type &P2) {
     return not(P1 == P2);
   }
 
@@ -160,10 +249,10 @@ namespace trng {
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  bool operator==(const poisson_dist &g1, const poisson_dist &g2) {
+  inline bool operator==(const poisson_dist &g1, const poisson_dist &g2) {
     return g1.param() == g2.param();
   }
-  bool operator!=(const poisson_dist &g1, const poisson_dist &g2) {
+  inline bool operator!=(const poisson_dist &g1, const poisson_dist &g2) {
     return g1.param() != g2.param();
   }
 
@@ -0,0 +1,139 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_PRECISION_HPP)
+
+#define TRNG_PRECISION_HPP
+
+#include <trng/cuda.hpp>
+#include <trng/limits.hpp>
+#include <trng/uniformxx.hpp>
+#include <cstddef>
+#include <ciso646>
+
+namespace trng {
+
+  // precision policies for the conversion of an engine's output into uniform floating point
+  // numbers
+
+  // a single engine call per random number, the resolution is limited by the engine's
+  // range, e.g., 31 bits for the mrg and yarn engines, this is the default
+  struct engine_precision {
+    template<typename ReturnType>
+    TRNG_CUDA_ENABLE static constexpr std::size_t bits() {
+      return 1;
+    }
+  };
+
+  // as many engine calls per random number as required to fill all binary digits of the
+  // floating point type, e.g., two calls of a yarn engine for a double
+  struct full_precision {
+    template<typename ReturnType>
+    TRNG_CUDA_ENABLE static constexpr std::size_t bits() {
+      return math::numeric_limits<ReturnType>::digits;
+    }
+  };
+
+  // reference to an engine that imposes a precision policy on all distributions that are
+  // fed by it, the engine is advanced by the reference's calls
+  template<typename R, typename Precision>
+  class precision_ref {
+  public:
+    using engine_type = R;
+    using precision_type = Precision;
+    using result_type = typename R::result_type;
+
+    TRNG_CUDA_ENABLE
+    explicit precision_ref(R &r) : r{r} {}
+
+    // Uniform random number generator concept
+    TRNG_CUDA_ENABLE
+    result_type operator()() { return r(); }
+    TRNG_CUDA_ENABLE
+    static constexpr result_type min() { return R::min(); }
+    TRNG_CUDA_ENABLE
+    static constexpr result_type max() { return R::max(); }
+
+    TRNG_CUDA_ENABLE
+    R &base() const { return r; }
+
+  private:
+    R &r;
+  };
+
+  template<typename Precision, typename R>
+  TRNG_CUDA_ENABLE inline precision_ref<R, Precision> with_precision(R &r) {
+    return precision_ref<R, Precision>(r);
+  }
+
+  namespace utility {
+
+    // uniform random numbers from a precision_ref follow its policy, independent of the
+    // number of bits requested by the caller
+    template<typename return_type, std::size_t requested_bits, typename R, typename Precision>
+    class u01xx_traits<return_type, requested_bits, precision_ref<R, Precision>> {
+      using traits = u01xx_traits<return_type, Precision::template bits<return_type>(), R>;
+      using prng_t = precision_ref<R, Precision>;
+
+    public:
+      TRNG_CUDA_ENABLE
+      static return_type cc(prng_t &r) { return traits::cc(r.base()); }
+      TRNG_CUDA_ENABLE
+      static return_type co(prng_t &r) { return traits::co(r.base()); }
+      TRNG_CUDA_ENABLE
+      static return_type oc(prng_t &r) { return traits::oc(r.base()); }
+      TRNG_CUDA_ENABLE
+      static return_type oo(prng_t &r) { return traits::oo(r.base()); }
+
+      template<typename OutputIt>
+      static void cc(prng_t &r, OutputIt first, OutputIt last) {
+        traits::cc(r.base(), first, last);
+      }
+      template<typename OutputIt>
+      static void co(prng_t &r, OutputIt first, OutputIt last) {
+        traits::co(r.base(), first, last);
+      }
+      template<typename OutputIt>
+      static void oc(prng_t &r, OutputIt first, OutputIt last) {
+        traits::oc(r.base(), first, last);
+      }
+      template<typename OutputIt>
+      static void oo(prng_t &r, OutputIt first, OutputIt last) {
+        traits::oo(r.base(), first, last);
+      }
+    };
+
+  }  // namespace utility
+
+}  // namespace trng
+
+#endif
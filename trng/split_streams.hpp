@@ -0,0 +1,112 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_SPLIT_STREAMS_HPP)
+
+#define TRNG_SPLIT_STREAMS_HPP
+
+#include <trng/utility.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_status.hpp>
+#include <vector>
+#include <stdexcept>
+#include <ciso646>
+
+namespace trng {
+
+  // all streams of a leapfrog split of a multiple recursive generator or a YARN generator,
+  // the leapfrog parameters are computed only once, and the start states of all streams
+  // are derived from a common run of the original sequence
+  template<typename R>
+  class mrg_split_streams {
+  public:
+    template<typename T, int n>
+    static std::vector<R> make(const R &r, unsigned int s, const mrg_status<T, n, R> *) {
+      std::vector<R> res(s, r);
+      if (s == 1)
+        return res;
+      // stream 0 carries the leapfrog parameters common to all streams
+      res[0].split(s, 0);
+      // stream j is set up from the values x_(j+1), x_(j+1+s), ..., x_(j+1+(n-1)s) of
+      // the original sequence, all these are found among x_1, ..., x_(n s)
+      std::vector<T> x(static_cast<std::size_t>(n) * s);
+      R t(r);
+      for (auto &x_i : x) {
+        t.step();
+        x_i = t.S.r[0];
+      }
+      for (unsigned int j{1}; j < s; ++j) {
+        res[j].P = res[0].P;
+        for (int i{0}; i < n; ++i)
+          res[j].S.r[i] = x[j + static_cast<std::size_t>(n - 1 - i) * s];
+        for (int i{0}; i < n; ++i)
+          res[j].backward();
+      }
+      return res;
+    }
+  };
+
+  namespace utility {
+
+    template<typename R, typename T, int n>
+    std::vector<R> split_streams(const R &r, unsigned int s, const mrg_status<T, n, R> *S) {
+      return mrg_split_streams<R>::make(r, s, S);
+    }
+
+    template<typename R>
+    std::vector<R> split_streams(const R &r, unsigned int s, const void *) {
+      std::vector<R> res(s, r);
+      for (unsigned int j{0}; j < s; ++j)
+        res[j].split(s, j);
+      return res;
+    }
+
+  }  // namespace utility
+
+  // returns the s streams of the leapfrog split of r, element j equals a copy of r after
+  // calling split(s, j)
+  template<typename R>
+  std::vector<R> make_split_streams(const R &r, unsigned int s) {
+    if (s < 1)
+      utility::throw_this(
+          std::invalid_argument("invalid argument for trng::make_split_streams"));
+    return utility::split_streams(r, s, static_cast<const typename R::status_type *>(nullptr));
+  }
+
+  template<typename R>
+  std::vector<R> make_split_streams(unsigned int s) {
+    return make_split_streams(R(), s);
+  }
+
+}  // namespace trng
+
+#endif
@@ -0,0 +1,187 @@
+// Copyright (c) 2000-2021, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_STREAM_ARRAY_HPP)
+
+#define TRNG_STREAM_ARRAY_HPP
+
+#include <trng/utility.hpp>
+#include <trng/int_math.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_status.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <ciso646>
+
+namespace trng {
+
+  // a set of independent streams of a multiple recursive generator or a YARN generator,
+  // parameters and status are stored column-wise, i.e., all streams' i-th parameter and
+  // i-th status element are contiguous, such that all streams are advanced within a single
+  // loop over the streams that the compiler may vectorize, each stream yields exactly the
+  // same sequence as the engine it has been created from
+  template<typename R>
+  class stream_array {
+    template<typename T, int d>
+    static constexpr int dimension(const mrg_status<T, d, R> *) {
+      return d;
+    }
+    static constexpr int dimension(const void *) { return 0; }
+
+  public:
+    using engine_type = R;
+    using result_type = typename R::result_type;
+    using parameter_type = typename R::parameter_type;
+    using status_type = typename R::status_type;
+
+  private:
+    static constexpr int n{dimension(static_cast<const status_type *>(nullptr))};
+    static_assert(n > 0, "stream_array requires a multiple recursive or a YARN generator");
+
+  public:
+    // s streams, each a copy of r
+    explicit stream_array(const R &r = R(), std::size_t s = 0)
+        : N{s}, a(n * s), x(n * s) {
+      for (std::size_t j{0}; j < N; ++j)
+        set(j, r);
+    }
+
+    // one stream per engine in the range [first, last)
+    template<typename InputIt>
+    explicit stream_array(InputIt first, InputIt last)
+        : stream_array(R(), static_cast<std::size_t>(std::distance(first, last))) {
+      for (std::size_t j{0}; first != last; ++first, ++j)
+        set(j, *first);
+    }
+
+    std::size_t size() const { return N; }
+
+    // copy of stream j as an independent engine
+    R engine(std::size_t j) const {
+      R t;
+      for (int i{0}; i < n; ++i) {
+        t.P.a[i] = a[i * N + j];
+        t.S.r[i] = x[column(i) * N + j];
+      }
+      return t;
+    }
+
+    // replaces stream j by a copy of r
+    void set(std::size_t j, const R &r) {
+      for (int i{0}; i < n; ++i) {
+        a[i * N + j] = r.P.a[i];
+        x[column(i) * N + j] = r.S.r[i];
+      }
+    }
+
+    // advances all streams by the given number of steps
+    void discard(unsigned long long steps) {
+      for (; steps > 0; --steps)
+        step();
+    }
+
+    // next number of each stream, size() numbers in total
+    template<typename OutputIt>
+    void generate(OutputIt first) {
+      step();
+      const result_type *const x0{x.data() + column(0) * N};
+      output(x0, first, static_cast<const R *>(nullptr));
+    }
+
+  private:
+    std::size_t N;
+    // a[i N + j] holds the i-th parameter of stream j, x[column(i) N + j] the i-th
+    // status element, the status columns are rotated instead of shifted
+    std::vector<result_type> a, x;
+    int offset{0};
+    // scratch space for the output transformation of YARN generators
+    std::vector<result_type> buffer;
+
+    std::size_t column(int i) const { return static_cast<std::size_t>((offset + i) % n); }
+
+    // the modulus equals 2^e - k for small k, reduces x modulo m partially, for x < 2^50
+    // the result is smaller than 2^e + 2^19 k
+    static constexpr int e{int_math::log2_ceil(R::modulus)};
+    static constexpr uint32_t k{(static_cast<uint32_t>(1) << e) - R::modulus};
+    static constexpr uint32_t mask{(static_cast<uint32_t>(1) << e) - 1u};
+    static_assert(e == 31 and k < (1u << 16u), "modulus not supported by stream_array");
+
+    static uint64_t fold(uint64_t x) {
+      return (x & mask) + static_cast<uint64_t>(static_cast<uint32_t>(x >> e)) * k;
+    }
+
+    void step() {
+      // the new values replace the oldest status column
+      const std::size_t c{column(n - 1)};
+      const result_type *a_i[n], *x_i[n];
+      for (int i{0}; i < n; ++i) {
+        a_i[i] = a.data() + i * N;
+        x_i[i] = x.data() + column(i) * N;
+      }
+      result_type *const y{x.data() + c * N};
+      for (std::size_t j{0}; j < N; ++j) {
+        uint64_t t{0};
+        for (int i{0}; i < n; ++i)
+          t += fold(static_cast<uint64_t>(static_cast<uint32_t>(a_i[i][j])) *
+                    static_cast<uint32_t>(x_i[i][j]));
+        t = fold(fold(t));
+        // final conditional subtraction via the sign bit, 64-bit comparisons do not
+        // vectorize on all targets
+        const uint64_t d{t - static_cast<uint64_t>(R::modulus)};
+        y[j] = static_cast<result_type>(d + (static_cast<uint64_t>(R::modulus) &
+                                             (static_cast<uint64_t>(0) - (d >> 63u))));
+      }
+      offset = static_cast<int>(c);
+    }
+
+    // YARN generators map the state onto the output via a modular exponentiation
+    template<typename OutputIt, typename S>
+    void output(const result_type *x0, OutputIt first, const S *,
+                decltype(S::g(result_type())) * = nullptr) {
+      buffer.resize(N);
+      S::g(x0, buffer.data(), N);
+      for (std::size_t j{0}; j < N; ++j, ++first)
+        *first = x0[j] == 0 ? 0 : buffer[j];
+    }
+
+    template<typename OutputIt>
+    void output(const result_type *x0, OutputIt first, const void *) {
+      std::copy(x0, x0 + N, first);
+    }
+  };
+
+}  // namespace trng
+
+#endif
@@ -109,6 +109,12 @@ namespace trng {
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &) {
       return utility::uniformco<result_type>(r);
     }
+    // fills [first, last) with random numbers, yields the same numbers as successive
+    // calls of operator()
+    template<typename R, typename OutputIt>
+    void generate(R &r, OutputIt first, OutputIt last) {
+      utility::uniformco<result_type>(r, first, last);
+    }
     // property methods
     // min / max
     TRNG_CUDA_ENABLE
@@ -39,10 +39,14 @@
 #include <trng/utility.hpp>
 #include <ostream>
 #include <istream>
+#include <cstdint>
 #include <ciso646>
 
 namespace trng {
 
+  template<typename R>
+  class bit_harvester;
+
   // uniform random number generator class
   class uniform_int_dist {
   public:
@@ -94,6 +98,13 @@ namespace trng {
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
       return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
     }
+    // takes as many bits of a bit_harvester as required to represent b - a - 1 per trial
+    template<typename R>
+    result_type operator()(bit_harvester<R> &r) {
+      if (P.d() < 1)
+        return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
+      return static_cast<result_type>(r.uniform_int(static_cast<uint32_t>(P.d()))) + P.a();
+    }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
       uniform_int_dist g(P);
@@ -138,12 +149,12 @@ namespace trng {
 
   // EqualityComparable concept
   TRNG_CUDA_ENABLE
-  bool operator==(const uniform_int_dist::param_type &P1,
+  inline bool operator==(const uniform_int_dist::param_type &P1,
                   const uniform_int_dist::param_type &P2) {
     return P1.a() == P2.a() and P1.b() == P2.b();
   }
   TRNG_CUDA_ENABLE
-  bool operator!=(const uniform_int_dist::param_type &P1,
+  inline bool operator!=(const uniform_int_dist::param_type &P1,
                   const uniform_int_dist::param_type &P2) {
     return not(P1 == P2);
   }
@@ -176,11 +187,11 @@ namespace trng {
 
   // EqualityComparable concept
   TRNG_CUDA_ENABLE
-  bool operator==(const uniform_int_dist &g1, const uniform_int_dist &g2) {
+  inline bool operator==(const uniform_int_dist &g1, const uniform_int_dist &g2) {
     return g1.param() == g2.param();
   }
   TRNG_CUDA_ENABLE
-  bool operator!=(const uniform_int_dist &g1, const uniform_int_dist &g2) {
+  inline bool operator!=(const uniform_int_dist &g1, const uniform_int_dist &g2) {
     return g1.param() != g2.param();
   }
 
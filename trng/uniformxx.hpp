@@ -37,7 +37,11 @@
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cfloat>
+#include <algorithm>
+#include <type_traits>
 #include <ciso646>
 
 namespace trng {
@@ -109,6 +113,36 @@ namespace trng {
 
     //------------------------------------------------------------------
 
+    // fills [first, first + n) with the output of r, uses the engine's bulk generation
+    // method if it provides one
+    template<typename R>
+    inline auto generate_raw(R &r, typename R::result_type *first, std::size_t n, int)
+        -> decltype(r.generate(first, n)) {
+      r.generate(first, n);
+    }
+
+    template<typename R>
+    inline void generate_raw(R &r, typename R::result_type *first, std::size_t n, long) {
+      for (std::size_t i{0}; i < n; ++i)
+        first[i] = r();
+    }
+
+    // exact conversion of an unsigned 64-bit integer into a double with a single rounding,
+    // 2^52 + y is given by the bit pattern of 2^52 with y in the mantissa for y < 2^52,
+    // unlike a native conversion this vectorizes on targets without 64-bit integer to
+    // floating point vector instructions
+    inline double exponent_fill(uint64_t x) {
+      const double two52{4503599627370496.0};
+      const uint64_t bits52{0x4330000000000000ull};
+      const uint64_t hi_bits{bits52 | (x >> 32u)}, lo_bits{bits52 | (x & 0xffffffffull)};
+      double hi, lo;
+      std::memcpy(&hi, &hi_bits, sizeof(hi));
+      std::memcpy(&lo, &lo_bits, sizeof(lo));
+      return (hi - two52) * 4294967296.0 + (lo - two52);
+    }
+
+    //------------------------------------------------------------------
+
     // With basic optimizations enabled, modern C++ compilers can reduce
     // all the public routines herein down to small inline code sequences.
     // They should also collapse the size (sizeof(u01xx_traits<...>) to 1.
@@ -145,9 +179,16 @@ namespace trng {
       static constexpr result_type domain_max =
           use_ll_of_shifted ? (domain_max0 >> 1u) : domain_max0;
 
+      // use the exponent-fill conversion in batch mode where a native conversion is
+      // not vectorizable
+      static constexpr bool use_exponent_fill = std::is_same<ret_t, double>::value and
+                                                not int_ok and
+                                                math::numeric_limits<result_type>::digits <= 64;
+
+      TRNG_CUDA_ENABLE
+      static ret_t addin(prng_t &r) { return convert(r() - prng_t::min()); }
       TRNG_CUDA_ENABLE
-      static ret_t addin(prng_t &r) {
-        const result_type x{r() - prng_t::min()};
+      static ret_t convert(result_type x) {
         if (int_ok)
           return static_cast<ret_t>(static_cast<int>(x));
         else if (long_ok)
@@ -214,6 +255,79 @@ namespace trng {
       static return_type oc(prng_t &r) { return ret_t(1) - co(r); }
       TRNG_CUDA_ENABLE
       static return_type oo(prng_t &r) { return variate(r) * oo_norm() + eps(); }
+
+      // batch versions of the above, fill [first, last) with the same numbers as successive
+      // calls of the single-number methods
+      template<typename OutputIt>
+      static void cc(prng_t &r, OutputIt first, OutputIt last) {
+        const ret_t v_max{variate_max()}, norm{cc_norm()};
+        if (v_max * norm != 1)
+          batch(r, first, last, [v_max](ret_t x) { return x / v_max; });
+        else
+          batch(r, first, last, [norm](ret_t x) { return x * norm; });
+      }
+      template<typename OutputIt>
+      static void co(prng_t &r, OutputIt first, OutputIt last) {
+        const ret_t norm{co_norm()};
+        batch(r, first, last, [norm](ret_t x) { return x * norm; });
+      }
+      template<typename OutputIt>
+      static void oc(prng_t &r, OutputIt first, OutputIt last) {
+        const ret_t norm{co_norm()};
+        batch(r, first, last, [norm](ret_t x) { return ret_t(1) - x * norm; });
+      }
+      template<typename OutputIt>
+      static void oo(prng_t &r, OutputIt first, OutputIt last) {
+        const ret_t norm{oo_norm()}, e{eps()};
+        batch(r, first, last, [norm, e](ret_t x) { return x * norm + e; });
+      }
+
+    private:
+      // the engine's output is generated and converted in chunks, where the conversion and
+      // normalization form simple loops without branches
+      static constexpr std::size_t chunk{256};
+
+      template<typename F>
+      static void batch(prng_t &r, ret_t *y, std::size_t n, F f) {
+        if (calls_needed == 1) {
+          result_type u[chunk];
+          generate_raw(r, u, n, 0);
+          for (std::size_t i{0}; i < n; ++i)
+            y[i] = f(fast_convert(u[i] - prng_t::min()));
+        } else {
+          for (std::size_t i{0}; i < n; ++i)
+            y[i] = f(variate(r));
+        }
+      }
+
+      template<typename F>
+      static void batch(prng_t &r, ret_t *first, ret_t *last, F f) {
+        while (first != last) {
+          const std::size_t left{static_cast<std::size_t>(last - first)};
+          const std::size_t n{left < chunk ? left : chunk};
+          batch(r, first, n, f);
+          first += n;
+        }
+      }
+
+      template<typename OutputIt, typename F>
+      static void batch(prng_t &r, OutputIt first, OutputIt last, F f) {
+        ret_t y[chunk];
+        while (first != last) {
+          std::size_t n{0};
+          for (OutputIt i{first}; n < chunk and i != last; ++i)
+            ++n;
+          batch(r, y, n, f);
+          first = std::copy(y, y + n, first);
+        }
+      }
+
+      static ret_t fast_convert(result_type x) {
+        if (use_exponent_fill)
+          return static_cast<ret_t>(
+              exponent_fill(static_cast<uint64_t>(use_ll_of_shifted ? x >> 1 : x)));
+        return convert(x);
+      }
     };
 
     template<typename ReturnType, std::size_t bits, typename UniformRandomNumberGenerator>
@@ -226,21 +340,89 @@ namespace trng {
       return u01xx_traits<ReturnType, 1, PrngType>::cc(r);
     }
 
+    template<typename ReturnType, typename PrngType, typename OutputIt>
+    inline void uniformcc(PrngType &r, OutputIt first, OutputIt last) {
+      u01xx_traits<ReturnType, 1, PrngType>::cc(r, first, last);
+    }
+
+    // with a precision policy, see trng/precision.hpp
+    template<typename ReturnType, typename PrngType, typename Precision>
+    TRNG_CUDA_ENABLE inline ReturnType uniformcc(PrngType &r, Precision) {
+      return u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>::cc(r);
+    }
+
+    template<typename ReturnType, typename PrngType, typename OutputIt, typename Precision>
+    inline void uniformcc(PrngType &r, OutputIt first, OutputIt last, Precision) {
+      using traits = u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>;
+      traits::cc(r, first, last);
+    }
+
     template<typename ReturnType, typename PrngType>
     TRNG_CUDA_ENABLE inline ReturnType uniformco(PrngType &r) {
       return u01xx_traits<ReturnType, 1, PrngType>::co(r);
     }
 
+    template<typename ReturnType, typename PrngType, typename OutputIt>
+    inline void uniformco(PrngType &r, OutputIt first, OutputIt last) {
+      u01xx_traits<ReturnType, 1, PrngType>::co(r, first, last);
+    }
+
+    // with a precision policy, see trng/precision.hpp
+    template<typename ReturnType, typename PrngType, typename Precision>
+    TRNG_CUDA_ENABLE inline ReturnType uniformco(PrngType &r, Precision) {
+      return u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>::co(r);
+    }
+
+    template<typename ReturnType, typename PrngType, typename OutputIt, typename Precision>
+    inline void uniformco(PrngType &r, OutputIt first, OutputIt last, Precision) {
+      using traits = u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>;
+      traits::co(r, first, last);
+    }
+
     template<typename ReturnType, typename PrngType>
     TRNG_CUDA_ENABLE inline ReturnType uniformoc(PrngType &r) {
       return u01xx_traits<ReturnType, 1, PrngType>::oc(r);
     }
 
+    template<typename ReturnType, typename PrngType, typename OutputIt>
+    inline void uniformoc(PrngType &r, OutputIt first, OutputIt last) {
+      u01xx_traits<ReturnType, 1, PrngType>::oc(r, first, last);
+    }
+
+    // with a precision policy, see trng/precision.hpp
+    template<typename ReturnType, typename PrngType, typename Precision>
+    TRNG_CUDA_ENABLE inline ReturnType uniformoc(PrngType &r, Precision) {
+      return u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>::oc(r);
+    }
+
+    template<typename ReturnType, typename PrngType, typename OutputIt, typename Precision>
+    inline void uniformoc(PrngType &r, OutputIt first, OutputIt last, Precision) {
+      using traits = u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>;
+      traits::oc(r, first, last);
+    }
+
     template<typename ReturnType, typename PrngType>
     TRNG_CUDA_ENABLE inline ReturnType uniformoo(PrngType &r) {
       return u01xx_traits<ReturnType, 1, PrngType>::oo(r);
     }
 
+    template<typename ReturnType, typename PrngType, typename OutputIt>
+    inline void uniformoo(PrngType &r, OutputIt first, OutputIt last) {
+      u01xx_traits<ReturnType, 1, PrngType>::oo(r, first, last);
+    }
+
+    // with a precision policy, see trng/precision.hpp
+    template<typename ReturnType, typename PrngType, typename Precision>
+    TRNG_CUDA_ENABLE inline ReturnType uniformoo(PrngType &r, Precision) {
+      return u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>::oo(r);
+    }
+
+    template<typename ReturnType, typename PrngType, typename OutputIt, typename Precision>
+    inline void uniformoo(PrngType &r, OutputIt first, OutputIt last, Precision) {
+      using traits = u01xx_traits<ReturnType, Precision::template bits<ReturnType>(), PrngType>;
+      traits::oo(r, first, last);
+    }
+
   }  // namespace utility
 
 }  // namespace trng
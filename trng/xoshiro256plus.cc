@@ -83,6 +83,26 @@ namespace trng {
   bool operator!=(const xoshiro256plus &R1, const xoshiro256plus &R2) { return not(R1 == R2); }
 
   // Parallel random number generator concept
+  const std::vector<GF2_matrix<256>> &xoshiro256plus::jump_matrices() {
+    // powers M^(2^i), i = 0, ..., 63, of the transition matrix M, bit b of the state word
+    // j is mapped to element 64 j + b
+    static const std::vector<GF2_matrix<256>> M_powers([]() {
+      GF2_matrix<256> M;
+      for (int i{0}; i < 256; ++i) {
+        xoshiro256plus R;
+        for (int j{0}; j < 4; ++j)
+          R.S.r[j] = j == i / 64 ? result_type(1) << (i % 64) : 0;
+        R.step();
+        for (int j{0}; j < 256; ++j)
+          M.set(j, i, ((R.S.r[j / 64] >> (j % 64)) & 1u) == 1u);
+      }
+      std::vector<GF2_matrix<256>> res(1, M);
+      for (int i{1}; i < 64; ++i)
+        res.push_back(res.back() * res.back());
+      return res;
+    }());
+    return M_powers;
+  }
 
   // Other useful methods
   const char *const xoshiro256plus::name_str = "xoshiro256plus";
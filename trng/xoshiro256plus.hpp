@@ -41,6 +41,7 @@
 #include <trng/generate_canonical.hpp>
 #include <trng/linear_algebra.hpp>
 #include <climits>
+#include <cstddef>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
@@ -202,6 +203,12 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
+    // Bulk generation
+    template<typename OutputIt>
+    TRNG_CUDA_ENABLE void generate(OutputIt, OutputIt);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
@@ -213,6 +220,7 @@ namespace trng {
 
     TRNG_CUDA_ENABLE
     void step();
+    static const std::vector<GF2_matrix<256>> &jump_matrices();
   };
 
   // Inline and template methods
@@ -239,34 +247,50 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, xoshiro256plus>(*this) * x);
   }
 
+  // Bulk generation
+
+  template<typename OutputIt>
+  TRNG_CUDA_ENABLE void xoshiro256plus::generate(OutputIt first, OutputIt last) {
+    result_type s0{S.r[0]}, s1{S.r[1]}, s2{S.r[2]}, s3{S.r[3]};
+    for (; first != last; ++first) {
+      const result_type t{s1 << 17};
+      s2 ^= s0;
+      s3 ^= s1;
+      s1 ^= s2;
+      s0 ^= s3;
+      s2 ^= t;
+      s3 = (s3 << 45) | (s3 >> (64 - 45));
+      *first = s0 + s3;
+    }
+    S.r[0] = s0;
+    S.r[1] = s1;
+    S.r[2] = s2;
+    S.r[3] = s3;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void xoshiro256plus::generate(xoshiro256plus::result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
   inline void xoshiro256plus::jump2(unsigned int s) {
-    matrix<GF2, 256> M;
-    for (int i{0}; i < 256; ++i) {
-      xoshiro256plus R;
-      R.S = status_type(i, status_type::eye{});
-      R.step();
-      const vector<GF2, 256> v{R.S.to_vector()};
-      for (int j{0}; j < 256; ++j)
-        M(j, i) = v(j);
-    }
-
-    for (unsigned int i{0}; i < s; ++i)
-      M = power(M, 2);
-    const vector<GF2, 256> v0{S.to_vector()};
-    const vector<GF2, 256> v1{M * v0};
-
-    for (int j{0}; j < 4; ++j) {
-      result_type r_j{0};
-      for (int i{0}; i < 64; ++i) {
-        r_j <<= 1;
-        if (static_cast<bool>(v1(i + 64 * j)))
-          r_j |= 1;
-      }
-      S.r[j] = r_j;
+    const std::vector<GF2_matrix<256>> &M{jump_matrices()};
+    GF2_vector<256> v;
+    for (int j{0}; j < 4; ++j)
+      v.word(j) = S.r[j];
+    if (s < M.size()) {
+      v = M[s] * v;
+    } else {
+      GF2_matrix<256> M_s{M.back()};
+      for (unsigned int i{static_cast<unsigned int>(M.size()) - 1}; i < s; ++i)
+        M_s = M_s * M_s;
+      v = M_s * v;
     }
+    for (int j{0}; j < 4; ++j)
+      S.r[j] = v.word(j);
   }
 
   TRNG_CUDA_ENABLE
@@ -275,28 +299,15 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
-      matrix<GF2, 256> M;
-      for (int i{0}; i < 256; ++i) {
-        xoshiro256plus R;
-        R.S = status_type(i, status_type::eye{});
-        R.step();
-        const vector<GF2, 256> v{R.S.to_vector()};
-        for (int j{0}; j < 256; ++j)
-          M(j, i) = v(j);
-      }
-
-      const vector<GF2, 256> v0{S.to_vector()};
-      const vector<GF2, 256> v1{power(M, s) * v0};
-
-      for (int j{0}; j < 4; ++j) {
-        result_type r_j{0};
-        for (int i{0}; i < 64; ++i) {
-          r_j <<= 1;
-          if (static_cast<bool>(v1(i + 64 * j)))
-            r_j |= 1;
-        }
-        S.r[j] = r_j;
-      }
+      const std::vector<GF2_matrix<256>> &M{jump_matrices()};
+      GF2_vector<256> v;
+      for (int j{0}; j < 4; ++j)
+        v.word(j) = S.r[j];
+      for (std::size_t i{0}; s > 0; ++i, s >>= 1u)
+        if ((s & 1ull) == 1ull)
+          v = M[i] * v;
+      for (int j{0}; j < 4; ++j)
+        S.r[j] = v.word(j);
     }
   }
 
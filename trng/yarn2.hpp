@@ -43,6 +43,7 @@
 #include <ostream>
 #include <istream>
 #include <stdexcept>
+#include <cstddef>
 #include <ciso646>
 
 namespace trng {
@@ -134,6 +135,11 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void discard(unsigned long long);
 
+    // Bulk generation
+    template<typename OutputIt>
+    void generate(OutputIt, OutputIt);
+    void generate(result_type *, std::size_t);
+
     // Other useful methods
     static const char *name();
     TRNG_CUDA_ENABLE
@@ -144,6 +150,11 @@ namespace trng {
     status_type S;
     static const char *const name_str;
 
+    template<typename>
+    friend class mrg_split_streams;
+    template<typename>
+    friend class stream_array;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -185,6 +196,42 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn2>(*this) * x);
   }
 
+  // Bulk generation
+
+  template<typename OutputIt>
+  void yarn2::generate(OutputIt first, OutputIt last) {
+    constexpr int block_size{16};
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])};
+    result_type r0{S.r[0]}, r1{S.r[1]};
+    // short sequences are generated step by step
+    for (int i{0}; i < 4 * block_size and first != last; ++i, ++first) {
+      const uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1)};
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 2>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    // longer sequences are generated in blocks of mutually independent linear
+    // combinations of the state, which can be evaluated in parallel
+    if (first == last)
+      return;
+    int32_t c[block_size * 2], x[block_size], y[block_size];
+    int_math::block_matrix<2, block_size>(P.a, c, modulus);
+    while (first != last) {
+      int_math::block_vec_mult<modulus, 2, block_size>(c, S.r, x);
+      g(x, y, block_size);
+      int i{0};
+      for (; i < block_size and first != last; ++i, ++first)
+        *first = x[i] == 0 ? 0 : y[i];
+      int_math::block_update<2, block_size>(S.r, x, i);
+    }
+  }
+
+  inline void yarn2::generate(yarn2::result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn2::split(unsigned int s, unsigned int n) {
@@ -220,6 +267,14 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn2::jump2(unsigned int s) {
+#if !(defined __CUDA_ARCH__)
+    if (s < int_math::jump_table<2>::size) {
+      const auto A(int_math::jump_table<2>::get(P.a, modulus));
+      const result_type r[2]{S.r[0], S.r[1]};
+      int_math::matrix_vec_mult<2>((*A)[s], r, S.r, modulus);
+      return;
+    }
+#endif
     result_type b[4], c[4]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
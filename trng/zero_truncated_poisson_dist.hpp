@@ -38,6 +38,8 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/poisson_dist.hpp>
+#include <cstddef>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -53,48 +55,64 @@ namespace trng {
 
     class param_type {
     private:
+      // smallest mean for which random numbers are generated by rejecting zeros from
+      // untruncated Poisson random numbers instead of sequential inversion if no table is
+      // available, zeros occur with probability below exp(-10) then
+      static constexpr double mu_rejection{10};
+
       double mu_{0};
-      std::vector<double> P_;
-
-      void calc_probabilities() {
-        P_ = std::vector<double>();
-        int x{1};
-        P_.push_back(0);
-        while (x < 7 or x < 2 * mu_) {
-          const double p{(math::exp(mu_) * math::GammaQ(x + 1.0, mu_) - 1) / math::expm1(mu_)};
-          P_.push_back(p);
-          ++x;
-        }
-        P_.push_back(1);
+      // probability of one and parameters of the untruncated Poisson distribution
+      double f1_{0};
+      poisson_dist::param_type poisson_;
+
+      void calc_parameters() {
+        if (mu_ >= mu_rejection)
+          poisson_ = poisson_dist::param_type(mu_);
+        else
+          f1_ = mu_ / math::expm1(mu_);
       }
 
     public:
       double mu() const { return mu_; }
       void mu(double mu_new) {
         mu_ = mu_new;
-        calc_probabilities();
+        calc_parameters();
       }
       param_type() = default;
-      explicit param_type(double mu) : mu_{mu} { calc_probabilities(); }
+      explicit param_type(double mu) : mu_{mu} { calc_parameters(); }
       friend class zero_truncated_poisson_dist;
     };
 
   private:
     param_type P;
+    // cumulative density function, the table is owned by the distribution and not by its
+    // parameters such that parameters are cheap to construct and to copy
+    std::vector<double> P_;
+
+    void calc_probabilities() {
+      P_ = std::vector<double>();
+      int x{1};
+      P_.push_back(0);
+      while (x < 7 or x < 2 * P.mu()) {
+        P_.push_back(cdf(x));
+        ++x;
+      }
+      P_.push_back(1);
+    }
 
   public:
     // constructor
-    explicit zero_truncated_poisson_dist(double mu) : P{mu} {}
-    explicit zero_truncated_poisson_dist(const param_type &P) : P{P} {}
+    explicit zero_truncated_poisson_dist(double mu) : P{mu} { calc_probabilities(); }
+    explicit zero_truncated_poisson_dist(const param_type &P) : P{P} { calc_probabilities(); }
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
       double p{utility::uniformco<double>(r)};
-      const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
+      const std::size_t x{utility::discrete(p, P_.begin(), P_.end())};
       int x_i{static_cast<int>(x)};
-      if (x + 1 == P.P_.size()) {
+      if (x + 1 == P_.size()) {
         p -= cdf(x_i);
         while (p > 0) {
           ++x_i;
@@ -103,18 +121,25 @@ namespace trng {
       }
       return x_i;
     }
+    // random numbers for parameters that may change from call to call, needs neither a
+    // table nor memory allocations
     template<typename R>
     int operator()(R &r, const param_type &p) {
-      zero_truncated_poisson_dist g(p);
-      return g(r);
+      return sample(r, p);
     }
     // property methods
     int min() const { return 1; }
     int max() const { return math::numeric_limits<int>::max(); }
     const param_type &param() const { return P; }
-    void param(const param_type &P_new) { P = P_new; }
+    void param(const param_type &P_new) {
+      P = P_new;
+      calc_probabilities();
+    }
     double mu() const { return P.mu(); }
-    void mu(double mu_new) { P.mu(mu_new); }
+    void mu(double mu_new) {
+      P.mu(mu_new);
+      calc_probabilities();
+    }
     // probability density function
     double pdf(int x) const {
       return x <= 0 ? 0.0
@@ -127,6 +152,40 @@ namespace trng {
                     : (math::exp(P.mu()) * math::GammaQ(x + 1.0, P.mu()) - 1) /
                           math::expm1(P.mu());
     }
+
+  private:
+    // sampling without table
+    template<typename R>
+    static int sample(R &r, const param_type &P) {
+      if (P.mu() >= param_type::mu_rejection) {
+        while (true) {
+          const int x{poisson_dist::sample(r, P.poisson_)};
+          if (x > 0)
+            return x;
+        }
+      }
+      return inversion(r, P);
+    }
+
+    // sequential inversion starting at one for mu < 10, takes one uniform random number and
+    // about mu steps per random number
+    template<typename R>
+    static int inversion(R &r, const param_type &P) {
+      double u{utility::uniformoo<double>(r)}, f{P.f1_};
+      int x{1};
+      while (u > f) {
+        u -= f;
+        ++x;
+        f *= P.mu() / x;
+        // u exceeds the sum of all probabilities due to rounding errors, start over
+        if (f == 0) {
+          u = utility::uniformoo<double>(r);
+          f = P.f1_;
+          x = 1;
+        }
+      }
+      return x;
+    }
   };
 
   // -------------------------------------------------------------------